@@ -0,0 +1,61 @@
+! concurrent_dictionary_benchmark.f90
+
+program main
+    use iso_fortran_env
+    use collections
+    !$ use omp_lib
+    implicit none
+
+    ! Parameters
+    integer(int32), parameter :: n = 1000000
+
+    ! Local Variables
+    type(concurrent_dictionary) :: x
+    integer(int32) :: i, nthreads, maxthreads
+    integer(int64) :: key
+    real(real64) :: t0, tadd, tget
+    logical :: found
+
+    ! Determine the maximum number of threads available
+    maxthreads = 1
+    !$ maxthreads = omp_get_max_threads()
+
+    ! Measure the throughput of add and contains_key as the number of threads
+    ! is increased
+    print '(A)', "Threads    Add (Mops/s)    Lookup (Mops/s)"
+    nthreads = 1
+    do while (nthreads <= maxthreads)
+        call x%initialize()
+
+        t0 = wall_time()
+        !$omp parallel do num_threads(nthreads) private(key)
+        do i = 1, n
+            key = int(i, int64)
+            call x%add(key, key)
+        end do
+        !$omp end parallel do
+        tadd = wall_time() - t0
+
+        t0 = wall_time()
+        !$omp parallel do num_threads(nthreads) private(key, found)
+        do i = 1, n
+            key = int(i, int64)
+            found = x%contains_key(key)
+        end do
+        !$omp end parallel do
+        tget = wall_time() - t0
+
+        print '(I7, F16.2, F19.2)', nthreads, 1.0d-6 * n / tadd, &
+            1.0d-6 * n / tget
+        nthreads = 2 * nthreads
+    end do
+
+contains
+    ! Returns the elapsed wall-clock time, in seconds.
+    function wall_time() result(rst)
+        real(real64) :: rst
+        integer(int64) :: count, rate
+        call system_clock(count, rate)
+        rst = real(count, real64) / real(rate, real64)
+    end function
+end program
@@ -0,0 +1,57 @@
+#ifndef BINARY_FILE_IO_H_
+#define BINARY_FILE_IO_H_
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Opens a file for positional (offset-based) reading.  The returned handle 
+ * carries no file position, so it may be shared by multiple threads, each
+ * reading a different region of the file concurrently.
+ * 
+ * @param fname The null-terminated name of the file to open.
+ * 
+ * @return A handle to the file, or NULL if the file could not be opened.
+ */
+void *open_positional_file_c(const char *fname);
+
+/**
+ * Closes a file opened via open_positional_file_c.
+ * 
+ * @param handle The file handle.  NULL is ignored.
+ */
+void close_positional_file_c(void *handle);
+
+/**
+ * Gets the size of a file opened via open_positional_file_c.
+ * 
+ * @param handle The file handle.
+ * 
+ * @return The file size, in bytes, or -1 if the size could not be determined.
+ */
+long long positional_file_size_c(void *handle);
+
+/**
+ * Reads a range of bytes from a file opened via open_positional_file_c 
+ * without referencing or altering any shared file position (i.e. pread).
+ * 
+ * @param handle The file handle.
+ * @param offset The zero-based byte offset at which to start reading.
+ * @param n The number of bytes to read.
+ * @param buffer The buffer, of at least n bytes, into which the data is 
+ *  written.
+ * 
+ * @return The number of bytes actually read.  This is less than n only if the
+ *  end of the file is encountered.  A value of -1 is returned if an error 
+ *  occurs.
+ */
+long long read_positional_file_c(void *handle, long long offset, long long n,
+    char *buffer);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // BINARY_FILE_IO_H_
@@ -0,0 +1,55 @@
+#ifndef NUMBER_FORMATTING_H_
+#define NUMBER_FORMATTING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The minimum size, in characters, of a buffer passed to any of the 
+ * formatting routines in this file.
+ */
+#define NUMBER_FORMAT_BUFFER_SIZE 32
+
+/**
+ * Formats a 64-bit floating-point value using the shortest string that reads
+ * back to exactly the same value.
+ * 
+ * @param x The value to format.
+ * @param buffer The buffer that will receive the text.  The buffer must be at
+ *  least NUMBER_FORMAT_BUFFER_SIZE characters long.  The text is not 
+ *  null-terminated.
+ * 
+ * @return The number of characters written to @p buffer.
+ */
+int format_real64_c(double x, char *buffer);
+
+/**
+ * Formats a 32-bit floating-point value using the shortest string that reads
+ * back to exactly the same value.
+ * 
+ * @param x The value to format.
+ * @param buffer The buffer that will receive the text.  The buffer must be at
+ *  least NUMBER_FORMAT_BUFFER_SIZE characters long.  The text is not 
+ *  null-terminated.
+ * 
+ * @return The number of characters written to @p buffer.
+ */
+int format_real32_c(float x, char *buffer);
+
+/**
+ * Formats a 64-bit integer value.
+ * 
+ * @param x The value to format.
+ * @param buffer The buffer that will receive the text.  The buffer must be at
+ *  least NUMBER_FORMAT_BUFFER_SIZE characters long.  The text is not 
+ *  null-terminated.
+ * 
+ * @return The number of characters written to @p buffer.
+ */
+int format_int64_c(long long x, char *buffer);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
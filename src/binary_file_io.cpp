@@ -0,0 +1,146 @@
+// binary_file_io.cpp
+
+#include "binary_file_io.h"
+#include <cstdlib>
+
+#ifdef _WIN32
+// Windows-Specific Code
+#include <windows.h>
+// End Windows-Specific Code
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <cerrno>
+#endif
+
+// The largest number of bytes requested from the operating system in a single 
+// call.  Larger requests are broken into pieces of this size.
+#define MAX_READ_CHUNK (1LL << 30)
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+/* ************************************************************************** */
+/*                            OPEN_POSITIONAL_FILE                            */
+/* ************************************************************************** */
+void *open_positional_file_c(const char *fname)
+{
+#ifdef _WIN32
+    // Windows-Specific Code
+    // An overlapped handle is required such that reads issued concurrently on
+    // the same handle are not serialized by the I/O manager.
+    HANDLE h = CreateFileA(fname, GENERIC_READ, 
+        FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, NULL);
+    if (h == INVALID_HANDLE_VALUE) return NULL;
+    HANDLE *rst = (HANDLE*)malloc(sizeof(HANDLE));
+    if (rst == NULL) {
+        CloseHandle(h);
+        return NULL;
+    }
+    *rst = h;
+    return (void*)rst;
+    // End Windows-Specific Code
+#else
+    int fd = open(fname, O_RDONLY);
+    if (fd < 0) return NULL;
+    int *rst = (int*)malloc(sizeof(int));
+    if (rst == NULL) {
+        close(fd);
+        return NULL;
+    }
+    *rst = fd;
+    return (void*)rst;
+#endif
+}
+
+/* ************************************************************************** */
+/*                           CLOSE_POSITIONAL_FILE                            */
+/* ************************************************************************** */
+void close_positional_file_c(void *handle)
+{
+    if (handle == NULL) return;
+#ifdef _WIN32
+    CloseHandle(*(HANDLE*)handle);
+#else
+    close(*(int*)handle);
+#endif
+    free(handle);
+}
+
+/* ************************************************************************** */
+/*                            POSITIONAL_FILE_SIZE                            */
+/* ************************************************************************** */
+long long positional_file_size_c(void *handle)
+{
+    if (handle == NULL) return -1;
+#ifdef _WIN32
+    LARGE_INTEGER sz;
+    if (!GetFileSizeEx(*(HANDLE*)handle, &sz)) return -1;
+    return (long long)sz.QuadPart;
+#else
+    struct stat st;
+    if (fstat(*(int*)handle, &st) != 0) return -1;
+    return (long long)st.st_size;
+#endif
+}
+
+/* ************************************************************************** */
+/*                            READ_POSITIONAL_FILE                            */
+/* ************************************************************************** */
+long long read_positional_file_c(void *handle, long long offset, long long n,
+    char *buffer)
+{
+    if (handle == NULL || offset < 0 || n < 0) return -1;
+    long long total = 0;
+
+#ifdef _WIN32
+    // Windows-Specific Code
+    HANDLE h = *(HANDLE*)handle;
+    HANDLE evt = CreateEvent(NULL, TRUE, FALSE, NULL);
+    if (evt == NULL) return -1;
+    while (total < n) {
+        OVERLAPPED ov = {0};
+        long long pos = offset + total;
+        ov.Offset = (DWORD)(pos & 0xFFFFFFFFLL);
+        ov.OffsetHigh = (DWORD)(pos >> 32);
+        ov.hEvent = evt;
+        DWORD request = (DWORD)MIN(n - total, MAX_READ_CHUNK), count = 0;
+        if (!ReadFile(h, buffer + total, request, NULL, &ov)) {
+            DWORD code = GetLastError();
+            if (code == ERROR_HANDLE_EOF) break;
+            if (code != ERROR_IO_PENDING) {
+                CloseHandle(evt);
+                return -1;
+            }
+        }
+        if (!GetOverlappedResult(h, &ov, &count, TRUE)) {
+            if (GetLastError() == ERROR_HANDLE_EOF) break;
+            CloseHandle(evt);
+            return -1;
+        }
+        if (count == 0) break;
+        total += (long long)count;
+    }
+    CloseHandle(evt);
+    // End Windows-Specific Code
+#else
+    int fd = *(int*)handle;
+    while (total < n) {
+        size_t request = (size_t)MIN(n - total, MAX_READ_CHUNK);
+        ssize_t count = pread(fd, buffer + total, request, 
+            (off_t)(offset + total));
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (count == 0) break;  // End of file
+        total += (long long)count;
+    }
+#endif
+
+    // End
+    return total;
+}
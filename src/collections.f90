@@ -5,12 +5,14 @@ module collections
     use iso_fortran_env
     use ferror
     use strings
+    !$ use omp_lib
     implicit none
     private
     public :: list
     public :: items_equal
     public :: compare_items
     public :: dictionary
+    public :: concurrent_dictionary
     public :: hash_code
     public :: linked_list
     public :: data_table
@@ -450,6 +452,233 @@ module collections
         procedure, private :: index_of_key => dict_index_of_key
     end type
 
+    !> @brief Defines a single lock-protected shard of a concurrent_dictionary.
+    !! Each shard is an open-addressed (linear probing) hash table.
+    type dictionary_shard
+        !> @brief The key stored in each slot.
+        integer(int64), allocatable, dimension(:) :: keys
+        !> @brief The value stored in each slot.
+        type(container), allocatable, dimension(:) :: values
+        !> @brief The state of each slot (empty, occupied, or deleted).
+        integer(int8), allocatable, dimension(:) :: states
+        !> @brief The number of occupied slots.
+        integer(int32) :: count = 0
+        !> @brief The number of deleted slots awaiting reuse.
+        integer(int32) :: deleted = 0
+    end type
+
+    !> @brief Defines a thread-safe dictionary suitable for use from within
+    !! OpenMP parallel regions.
+    !!
+    !! @par Remarks
+    !! The keys are distributed over a number of independently locked shards
+    !! (lock striping) such that threads operating on different shards never
+    !! contend with one another.  Each shard is a hash table, so lookups are
+    !! O(1) on average.  The dictionary must be initialized (via initialize)
+    !! prior to entering a parallel region.  Pointers returned by get and
+    !! get_or_add remain valid until the entry is replaced, removed, or the
+    !! dictionary is cleared.
+    type concurrent_dictionary
+    private
+        !> @brief The shards.
+        type(dictionary_shard), allocatable, dimension(:) :: m_shards
+        !> @brief The number of shards.  This is always a power of two.
+        integer(int32) :: m_shardCount = 0
+        !> @brief The shard locks.  The locks are held in a pointer array such
+        !! that read-only operations may still acquire them, and are spaced
+        !! apart to avoid false sharing.
+        !$ integer(omp_lock_kind), pointer, dimension(:) :: m_locks => null()
+    contains
+        !> @brief Cleans up resources held by the dictionary.
+        final :: cd_final
+        !> @brief Initializes the dictionary.  Any existing contents are 
+        !! cleared.  This routine is not thread-safe, and must be called prior
+        !! to using the dictionary from within a parallel region.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine initialize(class(concurrent_dictionary) this, integer(int32) nshards, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The concurrent_dictionary object.
+        !! @param[in] nshards An optional input specifying the number of 
+        !!  shards.  The value is rounded up to the next power of two.  The
+        !!  default is 64.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+        !!  - FCORE_INVALID_INPUT_ERROR: Occurs if @p nshards is less than 1.
+        procedure, public :: initialize => cd_initialize
+        !> @brief Gets the number of items in the dictionary.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! integer(int32) get_count(class(concurrent_dictionary) this)
+        !! @endcode
+        !!
+        !! @param[in] this The concurrent_dictionary object.
+        !! @return The number of items in the dictionary.  If other threads are
+        !!  concurrently modifying the dictionary, this value is a snapshot.
+        procedure, public :: get_count => cd_get_count
+        !> @brief Determines if the dictionary contains the specified key.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! logical contains_key(class(concurrent_dictionary) this, integer(int64) key)
+        !! @endcode
+        !!
+        !! @param[in] this The concurrent_dictionary object.
+        !! @param[in] key The desired key.
+        !!
+        !! @return Returns true if the dictionary contains @p key; else, returns
+        !!  false.
+        procedure, public :: contains_key => cd_contains_key
+        !> @brief Gets the requested item from the dictionary.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! class(*) pointer get(class(concurrent_dictionary) this, integer(int64) key)
+        !! @endcode
+        !!
+        !! @param[in] this The concurrent_dictionary object.
+        !! @param[in] key The key of the desired object.
+        !!
+        !! @return A pointer to the requested item.  A null pointer is returned
+        !!  if the key doesn't exist in the collection.
+        procedure, public :: get => cd_get
+        !> @brief Sets an item into the dictionary.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine set(class(concurrent_dictionary) this, integer(int64) key, class(*) item, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The concurrent_dictionary object.
+        !! @param[in] key The key.
+        !! @param[in] item The item to place into the dictionary.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+        !!  - FCORE_NONEXISTENT_KEY_ERROR: Occurs if @p key could not be found.
+        !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has
+        !!      not been initialized.
+        procedure, public :: set => cd_set
+        !> @brief Adds a new key-value pair to the dictionary.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine add(class(concurrent_dictionary) this, integer(int64) key, class(*) item, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The concurrent_dictionary object.
+        !! @param[in] key The key.
+        !! @param[in] item The item to add.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+        !!  - FCORE_EXISTING_KEY_ERROR: Occurs if the key already exists within the
+        !!      collection.
+        !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has
+        !!      not been initialized.
+        procedure, public :: add => cd_add
+        !> @brief Gets the item associated with the specified key.  If the key
+        !! does not exist, a copy of the supplied item is added, and a pointer
+        !! to the newly stored item is returned.  The lookup and insertion are
+        !! performed as a single atomic operation.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! class(*) pointer get_or_add(class(concurrent_dictionary) this, integer(int64) key, class(*) item, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The concurrent_dictionary object.
+        !! @param[in] key The key.
+        !! @param[in] item The item to add if @p key is not found.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+        !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has
+        !!      not been initialized.
+        !!
+        !! @return A pointer to the item stored in the dictionary.
+        procedure, public :: get_or_add => cd_get_or_add
+        !> @brief Removes an item from the dictionary.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! logical remove(class(concurrent_dictionary) this, integer(int64) key)
+        !! @endcode
+        !!
+        !! @param[in,out] this The concurrent_dictionary object.
+        !! @param[in] key The key.
+        !! @return Returns true if the item was found within the dictionary and
+        !!  removed; else, returns false if the key was not found in the 
+        !!  dictionary.
+        procedure, public :: remove => cd_remove
+        !> @brief Clears the contents of the entire dictionary.  The shard
+        !! structure is retained such that the dictionary remains initialized.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine clear(class(concurrent_dictionary) this)
+        !! @endcode
+        !!
+        !! @param[in,out] this The concurrent_dictionary object.
+        procedure, public :: clear => cd_clear
+        !> @brief Merges the contents of another dictionary into this 
+        !! dictionary.  Entries are grouped by shard such that each shard lock
+        !! is acquired only once.  This is intended for combining per-thread
+        !! local dictionaries after a parallel region, and may itself be 
+        !! called concurrently by several threads.
+        !!
+        !! @par Syntax #1
+        !! @code{.f90}
+        !! subroutine merge(class(concurrent_dictionary) this, class(dictionary) x, logical overwrite, class(errors) err)
+        !! @endcode
+        !!
+        !! @par Syntax #2
+        !! @code{.f90}
+        !! subroutine merge(class(concurrent_dictionary) this, class(concurrent_dictionary) x, logical overwrite, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The concurrent_dictionary object.
+        !! @param[in] x The dictionary to merge into this dictionary.  This
+        !!  dictionary must not be modified during the merge operation.
+        !! @param[in] overwrite An optional input determining if items in
+        !!  @p x replace items with matching keys already stored in this 
+        !!  dictionary.  The default is false, such that existing items are
+        !!  retained.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+        !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has
+        !!      not been initialized.
+        generic, public :: merge => cd_merge_dict, cd_merge_cdict
+
+        procedure :: cd_merge_dict
+        procedure :: cd_merge_cdict
+    end type
+
     !> @brief A hash code generation object.
     !!
     !! @par Remarks
@@ -646,6 +875,32 @@ module collections
         procedure, public :: move_to => ll_move_to_matching
     end type
 
+! ------------------------------------------------------------------------------
+    !> @brief Defines the lookup indexes built for a single column of a
+    !! data_table.
+    type column_index
+        !> @brief The function used to test items for equality.  This is null
+        !! if the column does not have a hash index.
+        procedure(items_equal), pointer, nopass :: equals => null()
+        !> @brief The hash of the item stored in each row.
+        integer(int64), allocatable, dimension(:) :: hashes
+        !> @brief The first row in each hash bucket, or 0 if the bucket is 
+        !! empty.
+        integer(int32), allocatable, dimension(:) :: buckets
+        !> @brief The next row in the same hash bucket as each row, or 0 if
+        !! there is no such row.  The rows in each bucket are kept in 
+        !! ascending order.
+        integer(int32), allocatable, dimension(:) :: next
+        !> @brief The function used to order items.  This is null if the
+        !! column does not have a sorted index.
+        procedure(compare_items), pointer, nopass :: compare => null()
+        !> @brief The rows sorted by value.  Rows holding equal values are
+        !! kept in ascending order.
+        integer(int32), allocatable, dimension(:) :: order
+        !> @brief The number of rows in order.
+        integer(int32) :: count = 0
+    end type
+
 ! ------------------------------------------------------------------------------
     !> @brief Defines a table convenient for storing mixed-type data.
     type data_table
@@ -654,6 +909,14 @@ module collections
         type(container), allocatable, dimension(:,:) :: m_table
         !> @brief The headers.
         type(string), allocatable, dimension(:) :: m_headers
+        !> @brief The lookup indexes for each column.  This is only allocated
+        !! once an index has been built.
+        type(column_index), allocatable, dimension(:) :: m_indexes
+        !> @brief An open-addressed hash table mapping header text to column
+        !! index.  Each slot holds a column index, or 0 if the slot is empty.
+        integer(int32), allocatable, dimension(:) :: m_headerMap
+        !> @brief The hash of each column header.
+        integer(int64), allocatable, dimension(:) :: m_headerHashes
     contains
         final :: dt_final
         !> @brief Clears the entire contents of the data_table.
@@ -1078,6 +1341,230 @@ module collections
         !! @return If found, the index of the column; else, if not found, a
         !!  value of 0 is returned.
         procedure, public :: get_column_index => dt_get_column_index
+        !> @brief Builds a hash index over the specified column such that 
+        !! items may be located by value in O(1) time on average.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine build_hash_index(class(data_table) this, integer(int32) col, procedure(items_equal) pointer fcn, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in] col The index of the column to index.
+        !! @param[in] fcn The function to use to compare the contents of the
+        !!  column against a search item.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+        !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the table has not
+        !!      been initialized.
+        !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p col is outside
+        !!      the bounds of the table.
+        !!  - FCORE_NULL_REFERENCE_ERROR: Occurs if @p fcn is not associated.
+        !!
+        !! @par Remarks
+        !! Items are hashed by value.  Integer, real, complex, logical, 
+        !! character, and string items are supported; items of any other type
+        !! share a single hash bucket, and are located by a linear search of
+        !! that bucket.  As such, @p fcn must only consider items equal if 
+        !! they hold the same value (e.g. an integer and a real holding the 
+        !! same value may be considered equal, but a case-insensitive string
+        !! comparison is not supported).  Once built, the index is kept up to
+        !! date by set, insert_rows, and remove_rows.
+        procedure, public :: build_hash_index => dt_build_hash_index
+        !> @brief Builds a sorted index over the specified column such that
+        !! items may be located by value, or by range, in O(log n) time.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine build_sorted_index(class(data_table) this, integer(int32) col, procedure(compare_items) pointer fcn, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in] col The index of the column to index.
+        !! @param[in] fcn The function to use to order the contents of the
+        !!  column.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+        !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the table has not
+        !!      been initialized.
+        !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p col is outside
+        !!      the bounds of the table.
+        !!  - FCORE_NULL_REFERENCE_ERROR: Occurs if @p fcn is not associated.
+        !!
+        !! @par Remarks
+        !! Once built, the index is kept up to date by set, insert_rows, and 
+        !! remove_rows.  Empty cells are not included in the index.
+        procedure, public :: build_sorted_index => dt_build_sorted_index
+        !> @brief Removes any indexes built for the specified column.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine remove_indexes(class(data_table) this, integer(int32) col, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in] col The index of the column.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p col is outside
+        !!      the bounds of the table.
+        procedure, public :: remove_indexes => dt_remove_indexes
+        !> @brief Determines if the specified column has a hash index.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! logical has_hash_index(class(data_table) this, integer(int32) col)
+        !! @endcode
+        !!
+        !! @param[in] this The data_table object.
+        !! @param[in] col The index of the column.
+        !! @return Returns true if @p col has a hash index; else, false.
+        procedure, public :: has_hash_index => dt_has_hash_index
+        !> @brief Determines if the specified column has a sorted index.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! logical has_sorted_index(class(data_table) this, integer(int32) col)
+        !! @endcode
+        !!
+        !! @param[in] this The data_table object.
+        !! @param[in] col The index of the column.
+        !! @return Returns true if @p col has a sorted index; else, false.
+        procedure, public :: has_sorted_index => dt_has_sorted_index
+        !> @brief Finds the first row in an indexed column holding the 
+        !! specified item.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! integer(int32) find(class(data_table) this, integer(int32) col, class(*) item, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in] this The data_table object.
+        !! @param[in] col The index of the column to search.
+        !! @param[in] item The item to search for.
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p col is outside
+        !!      the bounds of the table.
+        !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if @p col has not been
+        !!      indexed.
+        !! @return If found, the row index of the item; else, a value of 0.
+        !!
+        !! @par Remarks
+        !! The hash index is used if one exists; else, the sorted index is 
+        !! used.
+        procedure, public :: find => dt_find
+        !> @brief Finds all rows in a column with a sorted index whose items
+        !! lie within the specified range.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! integer(int32)(:) find_range(class(data_table) this, integer(int32) col, class(*) lower, class(*) upper, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in] this The data_table object.
+        !! @param[in] col The index of the column to search.
+        !! @param[in] lower The lower bound of the range (inclusive).
+        !! @param[in] upper The upper bound of the range (inclusive).
+        !! @param[in,out] err An optional errors-based object that if provided 
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p col is outside
+        !!      the bounds of the table.
+        !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if @p col does not have
+        !!      a sorted index.
+        !! @return The indices of the matching rows, ordered by value.  Rows
+        !!  holding equal values are listed in ascending order.
+        procedure, public :: find_range => dt_find_range
+        !> @brief Removes a single cell from the indexes of its column.  This
+        !! must be called prior to changing the contents of the cell.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine unindex_item(class(data_table) this, integer(int32) i, integer(int32) j)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in] i The row index of the cell.
+        !! @param[in] j The column index of the cell.
+        procedure, private :: unindex_item => dt_unindex_item
+        !> @brief Adds a single cell to the indexes of its column.  This must
+        !! be called after changing the contents of the cell.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine index_item(class(data_table) this, integer(int32) i, integer(int32) j)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in] i The row index of the cell.
+        !! @param[in] j The column index of the cell.
+        procedure, private :: index_item => dt_index_item
+        !> @brief Rebuilds every column index.  This must be called after
+        !! rows are added to, or removed from, the table.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine rebuild_indexes(class(data_table) this, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in,out] err The errors-based object used to report any 
+        !!  memory errors.
+        procedure, private :: rebuild_indexes => dt_rebuild_indexes
+        !> @brief Rebuilds the header-to-column map.  This must be called 
+        !! after columns are added to, or removed from, the table.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine build_header_map(class(data_table) this, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in,out] err The errors-based object used to report any 
+        !!  memory errors.
+        procedure, private :: build_header_map => dt_build_header_map
+        !> @brief Adds a column to the header-to-column map.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine map_header(class(data_table) this, integer(int32) i)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in] i The column index.
+        procedure, private :: map_header => dt_map_header
+        !> @brief Removes a column from the header-to-column map.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine unmap_header(class(data_table) this, integer(int32) i)
+        !! @endcode
+        !!
+        !! @param[in,out] this The data_table object.
+        !! @param[in] i The column index.
+        procedure, private :: unmap_header => dt_unmap_header
     end type
 
 ! ******************************************************************************
@@ -1282,6 +1769,82 @@ module collections
         end subroutine
     end interface
 
+! ------------------------------------------------------------------------------
+    interface ! collections_concurrent_dictionary.f90
+        module subroutine cd_initialize(this, nshards, err)
+            class(concurrent_dictionary), intent(inout) :: this
+            integer(int32), intent(in), optional :: nshards
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module function cd_get_count(this) result(rst)
+            class(concurrent_dictionary), intent(in) :: this
+            integer(int32) :: rst
+        end function
+
+        module function cd_contains_key(this, key) result(rst)
+            class(concurrent_dictionary), intent(in) :: this
+            integer(int64), intent(in) :: key
+            logical :: rst
+        end function
+
+        module function cd_get(this, key) result(rst)
+            class(concurrent_dictionary), intent(in) :: this
+            integer(int64), intent(in) :: key
+            class(*), pointer :: rst
+        end function
+
+        module subroutine cd_set(this, key, item, err)
+            class(concurrent_dictionary), intent(inout) :: this
+            integer(int64), intent(in) :: key
+            class(*), intent(in) :: item
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine cd_add(this, key, item, err)
+            class(concurrent_dictionary), intent(inout) :: this
+            integer(int64), intent(in) :: key
+            class(*), intent(in) :: item
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module function cd_get_or_add(this, key, item, err) result(rst)
+            class(concurrent_dictionary), intent(inout) :: this
+            integer(int64), intent(in) :: key
+            class(*), intent(in) :: item
+            class(errors), intent(inout), optional, target :: err
+            class(*), pointer :: rst
+        end function
+
+        module function cd_remove(this, key) result(rst)
+            class(concurrent_dictionary), intent(inout) :: this
+            integer(int64), intent(in) :: key
+            logical :: rst
+        end function
+
+        module subroutine cd_clear(this)
+            class(concurrent_dictionary), intent(inout) :: this
+        end subroutine
+
+        module subroutine cd_merge_dict(this, x, overwrite, err)
+            class(concurrent_dictionary), intent(inout) :: this
+            class(dictionary), intent(in) :: x
+            logical, intent(in), optional :: overwrite
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine cd_merge_cdict(this, x, overwrite, err)
+            class(concurrent_dictionary), intent(inout) :: this
+            class(concurrent_dictionary), intent(in) :: x
+            logical, intent(in), optional :: overwrite
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine cd_final(this)
+            type(concurrent_dictionary), intent(inout) :: this
+        end subroutine
+    end interface
+
 ! ------------------------------------------------------------------------------
     interface ! collections_hash.f90
         module subroutine hc_init(this)
@@ -1293,6 +1856,11 @@ module collections
             character(len = *), intent(in) :: str
             integer(int64) :: rst
         end function
+
+        pure module function mix_hash(h) result(rst)
+            integer(int64), intent(in) :: h
+            integer(int64) :: rst
+        end function
     end interface
 
 ! ------------------------------------------------------------------------------
@@ -1498,12 +2066,6 @@ module collections
             class(errors), intent(inout), optional, target :: err
         end subroutine
 
-        pure module function dt_get_column_index(this, hdr) result(rst)
-            class(data_table), intent(in) :: this
-            character(len = *), intent(in) :: hdr
-            integer(int32) :: rst
-        end function
-
         ! TO DO:
         ! - get row
         ! - get column
@@ -1513,5 +2075,93 @@ module collections
         ! - get column index by header string
     end interface
 
+! ------------------------------------------------------------------------------
+    interface ! collections_data_index.f90
+        pure module function dt_get_column_index(this, hdr) result(rst)
+            class(data_table), intent(in) :: this
+            character(len = *), intent(in) :: hdr
+            integer(int32) :: rst
+        end function
+
+        module subroutine dt_build_hash_index(this, col, fcn, err)
+            class(data_table), intent(inout) :: this
+            integer(int32), intent(in) :: col
+            procedure(items_equal), pointer, intent(in) :: fcn
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine dt_build_sorted_index(this, col, fcn, err)
+            class(data_table), intent(inout) :: this
+            integer(int32), intent(in) :: col
+            procedure(compare_items), pointer, intent(in) :: fcn
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine dt_remove_indexes(this, col, err)
+            class(data_table), intent(inout) :: this
+            integer(int32), intent(in) :: col
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        pure module function dt_has_hash_index(this, col) result(rst)
+            class(data_table), intent(in) :: this
+            integer(int32), intent(in) :: col
+            logical :: rst
+        end function
+
+        pure module function dt_has_sorted_index(this, col) result(rst)
+            class(data_table), intent(in) :: this
+            integer(int32), intent(in) :: col
+            logical :: rst
+        end function
+
+        module function dt_find(this, col, item, err) result(rst)
+            class(data_table), intent(in) :: this
+            integer(int32), intent(in) :: col
+            class(*), intent(in) :: item
+            class(errors), intent(inout), optional, target :: err
+            integer(int32) :: rst
+        end function
+
+        module function dt_find_range(this, col, lower, upper, err) &
+                result(rst)
+            class(data_table), intent(in) :: this
+            integer(int32), intent(in) :: col
+            class(*), intent(in) :: lower, upper
+            class(errors), intent(inout), optional, target :: err
+            integer(int32), allocatable, dimension(:) :: rst
+        end function
+
+        module subroutine dt_unindex_item(this, i, j)
+            class(data_table), intent(inout) :: this
+            integer(int32), intent(in) :: i, j
+        end subroutine
+
+        module subroutine dt_index_item(this, i, j)
+            class(data_table), intent(inout) :: this
+            integer(int32), intent(in) :: i, j
+        end subroutine
+
+        module subroutine dt_rebuild_indexes(this, err)
+            class(data_table), intent(inout) :: this
+            class(errors), intent(inout) :: err
+        end subroutine
+
+        module subroutine dt_build_header_map(this, err)
+            class(data_table), intent(inout) :: this
+            class(errors), intent(inout) :: err
+        end subroutine
+
+        pure module subroutine dt_map_header(this, i)
+            class(data_table), intent(inout) :: this
+            integer(int32), intent(in) :: i
+        end subroutine
+
+        pure module subroutine dt_unmap_header(this, i)
+            class(data_table), intent(inout) :: this
+            integer(int32), intent(in) :: i
+        end subroutine
+    end interface
+
 ! ------------------------------------------------------------------------------
 end module
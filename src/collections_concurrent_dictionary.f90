@@ -0,0 +1,940 @@
+! collections_concurrent_dictionary.f90
+
+submodule (collections) collections_concurrent_dictionary
+    use fcore_constants
+    implicit none
+
+    !> @brief The default number of shards.
+    integer(int32), parameter :: DEFAULT_SHARD_COUNT = 64
+    !> @brief The initial number of slots in each shard.  This must be a power
+    !! of two.
+    integer(int32), parameter :: INITIAL_SHARD_CAPACITY = 16
+    !> @brief The spacing, in lock elements, between adjacent shard locks.
+    !! This keeps each lock on its own cache line.
+    integer(int32), parameter :: LOCK_STRIDE = 16
+    !> @brief Denotes an empty slot.
+    integer(int8), parameter :: SLOT_EMPTY = 0
+    !> @brief Denotes an occupied slot.
+    integer(int8), parameter :: SLOT_OCCUPIED = 1
+    !> @brief Denotes a slot whose entry has been removed.
+    integer(int8), parameter :: SLOT_DELETED = 2
+contains
+! ******************************************************************************
+! PRIVATE HELPER ROUTINES
+! ------------------------------------------------------------------------------
+    !> @brief Gets the index of the shard responsible for the specified hash.
+    !!
+    !! @param[in] this The concurrent_dictionary object.
+    !! @param[in] h The hash.
+    !! @return The shard index.
+    pure function cd_shard_index(this, h) result(rst)
+        ! Arguments
+        class(concurrent_dictionary), intent(in) :: this
+        integer(int64), intent(in) :: h
+        integer(int32) :: rst
+
+        ! Process
+        rst = int(iand(ishft(h, -32), int(this%m_shardCount - 1, int64)), &
+            int32) + 1
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Acquires the lock on the specified shard.
+    !!
+    !! @param[in] this The concurrent_dictionary object.
+    !! @param[in] s The shard index.
+    subroutine cd_lock(this, s)
+        ! Arguments
+        class(concurrent_dictionary), intent(in) :: this
+        integer(int32), intent(in) :: s
+
+        ! Process
+        !$ call omp_set_lock(this%m_locks((s - 1) * LOCK_STRIDE + 1))
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Releases the lock on the specified shard.
+    !!
+    !! @param[in] this The concurrent_dictionary object.
+    !! @param[in] s The shard index.
+    subroutine cd_unlock(this, s)
+        ! Arguments
+        class(concurrent_dictionary), intent(in) :: this
+        integer(int32), intent(in) :: s
+
+        ! Process
+        !$ call omp_unset_lock(this%m_locks((s - 1) * LOCK_STRIDE + 1))
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Probes a shard for the specified key.
+    !!
+    !! @param[in] shard The shard.
+    !! @param[in] key The key.
+    !! @param[in] h The hash of @p key.
+    !! @param[out] rst If @p key was found, the index of the slot containing
+    !!  it.  If not found, the index of the slot into which @p key should be 
+    !!  inserted.
+    !! @param[out] found Set to true if @p key was found; else, false.
+    pure subroutine shard_probe(shard, key, h, rst, found)
+        ! Arguments
+        type(dictionary_shard), intent(in) :: shard
+        integer(int64), intent(in) :: key, h
+        integer(int32), intent(out) :: rst
+        logical, intent(out) :: found
+
+        ! Local Variables
+        integer(int32) :: i, j, n, mask
+
+        ! Initialization
+        found = .false.
+        rst = 0
+        n = size(shard%keys)
+        mask = n - 1
+        i = int(iand(h, int(mask, int64)), int32)
+
+        ! Linear probing.  The load factor is kept below one, so an empty slot
+        ! always terminates the search.
+        do j = 1, n
+            select case (shard%states(i + 1))
+            case (SLOT_EMPTY)
+                if (rst == 0) rst = i + 1
+                return
+            case (SLOT_DELETED)
+                if (rst == 0) rst = i + 1
+            case default
+                if (shard%keys(i + 1) == key) then
+                    found = .true.
+                    rst = i + 1
+                    return
+                end if
+            end select
+            i = iand(i + 1, mask)
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Allocates the storage for a shard.
+    !!
+    !! @param[in,out] shard The shard.
+    !! @param[in] n The number of slots.  This must be a power of two.
+    !! @param[out] flag The allocation status flag.
+    subroutine shard_allocate(shard, n, flag)
+        ! Arguments
+        type(dictionary_shard), intent(inout) :: shard
+        integer(int32), intent(in) :: n
+        integer(int32), intent(out) :: flag
+
+        ! Process
+        if (allocated(shard%keys)) deallocate(shard%keys)
+        if (allocated(shard%values)) deallocate(shard%values)
+        if (allocated(shard%states)) deallocate(shard%states)
+        allocate(shard%keys(n), shard%values(n), shard%states(n), stat = flag)
+        if (flag /= 0) return
+        shard%states = SLOT_EMPTY
+        shard%count = 0
+        shard%deleted = 0
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Ensures a shard has room for one more entry, rehashing the shard
+    !! if necessary.
+    !!
+    !! @param[in,out] shard The shard.
+    !! @param[out] flag The allocation status flag.
+    subroutine shard_reserve(shard, flag)
+        ! Arguments
+        type(dictionary_shard), intent(inout) :: shard
+        integer(int32), intent(out) :: flag
+
+        ! Local Variables
+        type(dictionary_shard) :: old
+        integer(int32) :: i, j, n
+        logical :: found
+
+        ! Quick Return - keep the load factor (including deleted slots) at or
+        ! below 75%
+        flag = 0
+        n = size(shard%keys)
+        if ((shard%count + shard%deleted + 1) * 4 <= n * 3) return
+
+        ! Grow if the live entries alone warrant it; otherwise, simply rehash
+        ! to reclaim the deleted slots
+        if ((shard%count + 1) * 2 > n) n = 2 * n
+
+        call move_alloc(shard%keys, old%keys)
+        call move_alloc(shard%values, old%values)
+        call move_alloc(shard%states, old%states)
+        call shard_allocate(shard, n, flag)
+        if (flag /= 0) then
+            call move_alloc(old%keys, shard%keys)
+            call move_alloc(old%values, shard%values)
+            call move_alloc(old%states, shard%states)
+            return
+        end if
+
+        ! Reinsert the live entries
+        do i = 1, size(old%keys)
+            if (old%states(i) /= SLOT_OCCUPIED) cycle
+            call shard_probe(shard, old%keys(i), mix_hash(old%keys(i)), j, found)
+            shard%keys(j) = old%keys(i)
+            shard%values(j)%item => old%values(i)%item
+            shard%states(j) = SLOT_OCCUPIED
+            shard%count = shard%count + 1
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Inserts a copy of an item into a shard.  The key is assumed to
+    !! not already exist within the shard.
+    !!
+    !! @param[in,out] shard The shard.
+    !! @param[in] key The key.
+    !! @param[in] h The hash of @p key.
+    !! @param[in] item The item to copy into the shard.
+    !! @param[out] ptr A pointer to the stored copy of @p item.
+    !! @param[out] flag The allocation status flag.
+    subroutine shard_insert(shard, key, h, item, ptr, flag)
+        ! Arguments
+        type(dictionary_shard), intent(inout) :: shard
+        integer(int64), intent(in) :: key, h
+        class(*), intent(in) :: item
+        class(*), pointer, intent(out) :: ptr
+        integer(int32), intent(out) :: flag
+
+        ! Local Variables
+        integer(int32) :: i
+        logical :: found
+
+        ! Process
+        nullify(ptr)
+        call shard_reserve(shard, flag)
+        if (flag /= 0) return
+        allocate(ptr, source = item, stat = flag)
+        if (flag /= 0) return
+
+        call shard_probe(shard, key, h, i, found)
+        if (shard%states(i) == SLOT_DELETED) shard%deleted = shard%deleted - 1
+        shard%keys(i) = key
+        shard%values(i)%item => ptr
+        shard%states(i) = SLOT_OCCUPIED
+        shard%count = shard%count + 1
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Replaces the item stored in the specified slot with a copy of
+    !! the supplied item.
+    !!
+    !! @param[in,out] shard The shard.
+    !! @param[in] i The slot index.
+    !! @param[in] item The item to copy into the shard.
+    !! @param[out] flag The allocation status flag.
+    subroutine shard_replace(shard, i, item, flag)
+        ! Arguments
+        type(dictionary_shard), intent(inout) :: shard
+        integer(int32), intent(in) :: i
+        class(*), intent(in) :: item
+        integer(int32), intent(out) :: flag
+
+        ! Local Variables
+        class(*), pointer :: cpy
+
+        ! Process
+        allocate(cpy, source = item, stat = flag)
+        if (flag /= 0) return
+        if (associated(shard%values(i)%item)) deallocate(shard%values(i)%item)
+        shard%values(i)%item => cpy
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Releases all resources held by the dictionary, including the
+    !! shard locks.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    subroutine cd_free(this)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+
+        ! Local Variables
+        !$ integer(int32) :: s
+
+        ! Process
+        if (this%m_shardCount == 0) return
+        call this%clear()
+        !$ do s = 1, this%m_shardCount
+        !$     call omp_destroy_lock(this%m_locks((s - 1) * LOCK_STRIDE + 1))
+        !$ end do
+        !$ deallocate(this%m_locks)
+        deallocate(this%m_shards)
+        this%m_shardCount = 0
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Merges a set of key-value pairs into the dictionary.  The pairs
+    !! are grouped by shard such that each shard lock is acquired only once.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    !! @param[in] keys The keys.
+    !! @param[in] values The values associated with each key.
+    !! @param[in] overwrite Determines if existing items are replaced.
+    !! @param[in,out] errmgr The error handling object.
+    subroutine cd_merge_pairs(this, keys, values, overwrite, errmgr)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+        integer(int64), intent(in), dimension(:) :: keys
+        type(container), intent(in), dimension(:) :: values
+        logical, intent(in) :: overwrite
+        class(errors), intent(inout) :: errmgr
+
+        ! Local Variables
+        integer(int32) :: i, j, k, n, s, flag
+        integer(int64), allocatable, dimension(:) :: hashes
+        integer(int32), allocatable, dimension(:) :: shards, offsets, order
+        class(*), pointer :: ptr
+        logical :: found
+
+        ! Initialization
+        n = size(keys)
+        if (n == 0) return
+        allocate(hashes(n), shards(n), order(n), &
+            offsets(this%m_shardCount + 1), stat = flag)
+        if (flag /= 0) go to 100
+
+        ! Bucket the pairs by shard (counting sort)
+        offsets = 0
+        do i = 1, n
+            hashes(i) = mix_hash(keys(i))
+            shards(i) = cd_shard_index(this, hashes(i))
+            offsets(shards(i) + 1) = offsets(shards(i) + 1) + 1
+        end do
+        offsets(1) = 1
+        do s = 2, this%m_shardCount + 1
+            offsets(s) = offsets(s) + offsets(s - 1)
+        end do
+        do i = 1, n
+            order(offsets(shards(i))) = i
+            offsets(shards(i)) = offsets(shards(i)) + 1
+        end do
+        do s = this%m_shardCount + 1, 2, -1
+            offsets(s) = offsets(s - 1)
+        end do
+        offsets(1) = 1
+
+        ! Process each shard under a single lock acquisition
+        do s = 1, this%m_shardCount
+            if (offsets(s + 1) == offsets(s)) cycle
+            call cd_lock(this, s)
+            do k = offsets(s), offsets(s + 1) - 1
+                j = order(k)
+                if (.not.associated(values(j)%item)) cycle
+                call shard_probe(this%m_shards(s), keys(j), hashes(j), i, found)
+                if (found) then
+                    if (overwrite) call shard_replace(this%m_shards(s), i, &
+                        values(j)%item, flag)
+                else
+                    call shard_insert(this%m_shards(s), keys(j), hashes(j), &
+                        values(j)%item, ptr, flag)
+                end if
+                if (flag /= 0) exit
+            end do
+            call cd_unlock(this, s)
+            if (flag /= 0) go to 100
+        end do
+
+        ! End
+        return
+
+    100 continue
+        call errmgr%report_error("cd_merge", &
+            "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        return
+    end subroutine
+
+! ******************************************************************************
+! CONCURRENT_DICTIONARY MEMBERS
+! ------------------------------------------------------------------------------
+    !> @brief Initializes the dictionary.  Any existing contents are cleared.
+    !! This routine is not thread-safe, and must be called prior to using the
+    !! dictionary from within a parallel region.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    !! @param[in] nshards An optional input specifying the number of shards.
+    !!  The value is rounded up to the next power of two.  The default is 64.
+    !! @param[in,out] err An optional errors-based object that if provided can be
+    !!  used to retrieve information relating to any errors encountered during
+    !!  execution.  If not provided, a default implementation of the errors
+    !!  class is used internally to provide error handling.  Possible errors and
+    !!  warning messages that may be encountered are as follows.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+    !!  - FCORE_INVALID_INPUT_ERROR: Occurs if @p nshards is less than 1.
+    module subroutine cd_initialize(this, nshards, err)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+        integer(int32), intent(in), optional :: nshards
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: n, s, flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        n = DEFAULT_SHARD_COUNT
+        if (present(nshards)) then
+            if (nshards < 1) then
+                call errmgr%report_error("cd_initialize", &
+                    "The number of shards must be at least 1.", &
+                    FCORE_INVALID_INPUT_ERROR)
+                return
+            end if
+            n = 1
+            do while (n < nshards)
+                n = 2 * n
+            end do
+        end if
+
+        ! Release any existing resources
+        call cd_free(this)
+
+        ! Build the shards
+        allocate(this%m_shards(n), stat = flag)
+        if (flag /= 0) go to 100
+        do s = 1, n
+            call shard_allocate(this%m_shards(s), INITIAL_SHARD_CAPACITY, flag)
+            if (flag /= 0) then
+                deallocate(this%m_shards)
+                go to 100
+            end if
+        end do
+
+        ! Build the locks
+        !$ allocate(this%m_locks(n * LOCK_STRIDE), stat = flag)
+        !$ if (flag /= 0) then
+        !$     deallocate(this%m_shards)
+        !$     go to 100
+        !$ end if
+        !$ do s = 1, n
+        !$     call omp_init_lock(this%m_locks((s - 1) * LOCK_STRIDE + 1))
+        !$ end do
+        this%m_shardCount = n
+
+        ! End
+        return
+
+    100 continue
+        call errmgr%report_error("cd_initialize", &
+            "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        return
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Gets the number of items in the dictionary.
+    !!
+    !! @param[in] this The concurrent_dictionary object.
+    !! @return The number of items in the dictionary.
+    module function cd_get_count(this) result(rst)
+        ! Arguments
+        class(concurrent_dictionary), intent(in) :: this
+        integer(int32) :: rst
+
+        ! Local Variables
+        integer(int32) :: s
+
+        ! Process
+        rst = 0
+        do s = 1, this%m_shardCount
+            call cd_lock(this, s)
+            rst = rst + this%m_shards(s)%count
+            call cd_unlock(this, s)
+        end do
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Determines if the dictionary contains the specified key.
+    !!
+    !! @param[in] this The concurrent_dictionary object.
+    !! @param[in] key The desired key.
+    !!
+    !! @return Returns true if the dictionary contains @p key; else, returns
+    !!  false.
+    module function cd_contains_key(this, key) result(rst)
+        ! Arguments
+        class(concurrent_dictionary), intent(in) :: this
+        integer(int64), intent(in) :: key
+        logical :: rst
+
+        ! Local Variables
+        integer(int32) :: i, s
+        integer(int64) :: h
+
+        ! Process
+        rst = .false.
+        if (this%m_shardCount == 0) return
+        h = mix_hash(key)
+        s = cd_shard_index(this, h)
+        call cd_lock(this, s)
+        call shard_probe(this%m_shards(s), key, h, i, rst)
+        call cd_unlock(this, s)
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Gets the requested item from the dictionary.
+    !!
+    !! @param[in] this The concurrent_dictionary object.
+    !! @param[in] key The key of the desired object.
+    !!
+    !! @return A pointer to the requested item.  A null pointer is returned
+    !!  if the key doesn't exist in the collection.
+    module function cd_get(this, key) result(rst)
+        ! Arguments
+        class(concurrent_dictionary), intent(in) :: this
+        integer(int64), intent(in) :: key
+        class(*), pointer :: rst
+
+        ! Local Variables
+        integer(int32) :: i, s
+        integer(int64) :: h
+        logical :: found
+
+        ! Process
+        nullify(rst)
+        if (this%m_shardCount == 0) return
+        h = mix_hash(key)
+        s = cd_shard_index(this, h)
+        call cd_lock(this, s)
+        call shard_probe(this%m_shards(s), key, h, i, found)
+        if (found) rst => this%m_shards(s)%values(i)%item
+        call cd_unlock(this, s)
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Sets an item into the dictionary.  If the item's key doesn't
+    !!  already exist an error is thrown.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    !! @param[in] key The key.
+    !! @param[in] item The item to place into the dictionary.
+    !! @param[in,out] err An optional errors-based object that if provided can be
+    !!  used to retrieve information relating to any errors encountered during
+    !!  execution.  If not provided, a default implementation of the errors
+    !!  class is used internally to provide error handling.  Possible errors and
+    !!  warning messages that may be encountered are as follows.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+    !!  - FCORE_NONEXISTENT_KEY_ERROR: Occurs if @p key could not be found.
+    !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has not
+    !!      been initialized.
+    module subroutine cd_set(this, key, item, err)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+        integer(int64), intent(in) :: key
+        class(*), intent(in) :: item
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: i, s, flag
+        integer(int64) :: h
+        logical :: found
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Ensure the dictionary is initialized
+        if (this%m_shardCount == 0) then
+            call errmgr%report_error("cd_set", &
+                "The dictionary has not been initialized.", &
+                FCORE_UNINITIALIZED_OBJECT_ERROR)
+            return
+        end if
+
+        ! Process
+        flag = 0
+        h = mix_hash(key)
+        s = cd_shard_index(this, h)
+        call cd_lock(this, s)
+        call shard_probe(this%m_shards(s), key, h, i, found)
+        if (found) call shard_replace(this%m_shards(s), i, item, flag)
+        call cd_unlock(this, s)
+
+        ! Check for errors
+        if (.not.found) then
+            call errmgr%report_error("cd_set", &
+                "The specified key could not be found in the dictionary.", &
+                FCORE_NONEXISTENT_KEY_ERROR)
+        else if (flag /= 0) then
+            call errmgr%report_error("cd_set", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Adds a new key-value pair to the dictionary.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    !! @param[in] key The key.
+    !! @param[in] item The item to add.
+    !! @param[in,out] err An optional errors-based object that if provided can be
+    !!  used to retrieve information relating to any errors encountered during
+    !!  execution.  If not provided, a default implementation of the errors
+    !!  class is used internally to provide error handling.  Possible errors and
+    !!  warning messages that may be encountered are as follows.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+    !!  - FCORE_EXISTING_KEY_ERROR: Occurs if the key already exists within the
+    !!      collection.
+    !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has not
+    !!      been initialized.
+    module subroutine cd_add(this, key, item, err)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+        integer(int64), intent(in) :: key
+        class(*), intent(in) :: item
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: i, s, flag
+        integer(int64) :: h
+        logical :: found
+        class(*), pointer :: ptr
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Ensure the dictionary is initialized
+        if (this%m_shardCount == 0) then
+            call errmgr%report_error("cd_add", &
+                "The dictionary has not been initialized.", &
+                FCORE_UNINITIALIZED_OBJECT_ERROR)
+            return
+        end if
+
+        ! Process
+        flag = 0
+        h = mix_hash(key)
+        s = cd_shard_index(this, h)
+        call cd_lock(this, s)
+        call shard_probe(this%m_shards(s), key, h, i, found)
+        if (.not.found) call shard_insert(this%m_shards(s), key, h, item, &
+            ptr, flag)
+        call cd_unlock(this, s)
+
+        ! Check for errors
+        if (found) then
+            call errmgr%report_error("cd_add", "An item with the " // &
+                "specified key already exists within this dictionary.", &
+                FCORE_EXISTING_KEY_ERROR)
+        else if (flag /= 0) then
+            call errmgr%report_error("cd_add", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Gets the item associated with the specified key.  If the key
+    !! does not exist, a copy of the supplied item is added, and a pointer to
+    !! the newly stored item is returned.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    !! @param[in] key The key.
+    !! @param[in] item The item to add if @p key is not found.
+    !! @param[in,out] err An optional errors-based object that if provided can be
+    !!  used to retrieve information relating to any errors encountered during
+    !!  execution.  If not provided, a default implementation of the errors
+    !!  class is used internally to provide error handling.  Possible errors and
+    !!  warning messages that may be encountered are as follows.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+    !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has not
+    !!      been initialized.
+    !!
+    !! @return A pointer to the item stored in the dictionary.
+    module function cd_get_or_add(this, key, item, err) result(rst)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+        integer(int64), intent(in) :: key
+        class(*), intent(in) :: item
+        class(errors), intent(inout), optional, target :: err
+        class(*), pointer :: rst
+
+        ! Local Variables
+        integer(int32) :: i, s, flag
+        integer(int64) :: h
+        logical :: found
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        nullify(rst)
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Ensure the dictionary is initialized
+        if (this%m_shardCount == 0) then
+            call errmgr%report_error("cd_get_or_add", &
+                "The dictionary has not been initialized.", &
+                FCORE_UNINITIALIZED_OBJECT_ERROR)
+            return
+        end if
+
+        ! Process
+        flag = 0
+        h = mix_hash(key)
+        s = cd_shard_index(this, h)
+        call cd_lock(this, s)
+        call shard_probe(this%m_shards(s), key, h, i, found)
+        if (found) then
+            rst => this%m_shards(s)%values(i)%item
+        else
+            call shard_insert(this%m_shards(s), key, h, item, rst, flag)
+        end if
+        call cd_unlock(this, s)
+
+        ! Check for errors
+        if (flag /= 0) then
+            call errmgr%report_error("cd_get_or_add", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        end if
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Removes an item from the dictionary.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    !! @param[in] key The key.
+    !! @return Returns true if the item was found within the dictionary and
+    !!  removed; else, returns false if the key was not found in the
+    !!  dictionary.
+    module function cd_remove(this, key) result(rst)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+        integer(int64), intent(in) :: key
+        logical :: rst
+
+        ! Local Variables
+        integer(int32) :: i, s
+        integer(int64) :: h
+
+        ! Process
+        rst = .false.
+        if (this%m_shardCount == 0) return
+        h = mix_hash(key)
+        s = cd_shard_index(this, h)
+        call cd_lock(this, s)
+        call shard_probe(this%m_shards(s), key, h, i, rst)
+        if (rst) then
+            associate (shard => this%m_shards(s))
+                if (associated(shard%values(i)%item)) &
+                    deallocate(shard%values(i)%item)
+                shard%states(i) = SLOT_DELETED
+                shard%count = shard%count - 1
+                shard%deleted = shard%deleted + 1
+            end associate
+        end if
+        call cd_unlock(this, s)
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Clears the contents of the entire dictionary.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    module subroutine cd_clear(this)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+
+        ! Local Variables
+        integer(int32) :: i, s
+
+        ! Process
+        do s = 1, this%m_shardCount
+            call cd_lock(this, s)
+            associate (shard => this%m_shards(s))
+                do i = 1, size(shard%states)
+                    if (shard%states(i) == SLOT_OCCUPIED) then
+                        if (associated(shard%values(i)%item)) &
+                            deallocate(shard%values(i)%item)
+                    end if
+                    nullify(shard%values(i)%item)
+                end do
+                shard%states = SLOT_EMPTY
+                shard%count = 0
+                shard%deleted = 0
+            end associate
+            call cd_unlock(this, s)
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Merges the contents of a dictionary into this dictionary.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    !! @param[in] x The dictionary to merge into this dictionary.
+    !! @param[in] overwrite An optional input determining if items in @p x
+    !!  replace items with matching keys already stored in this dictionary.
+    !!  The default is false, such that existing items are retained.
+    !! @param[in,out] err An optional errors-based object that if provided can be
+    !!  used to retrieve information relating to any errors encountered during
+    !!  execution.  If not provided, a default implementation of the errors
+    !!  class is used internally to provide error handling.  Possible errors and
+    !!  warning messages that may be encountered are as follows.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+    !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has not
+    !!      been initialized.
+    module subroutine cd_merge_dict(this, x, overwrite, err)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+        class(dictionary), intent(in) :: x
+        logical, intent(in), optional :: overwrite
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: i, n, flag
+        logical :: replace
+        integer(int64), allocatable, dimension(:) :: keys
+        type(container), allocatable, dimension(:) :: values
+        class(*), pointer :: item
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        replace = .false.
+        if (present(overwrite)) replace = overwrite
+
+        ! Ensure the dictionary is initialized
+        if (this%m_shardCount == 0) then
+            call errmgr%report_error("cd_merge_dict", &
+                "The dictionary has not been initialized.", &
+                FCORE_UNINITIALIZED_OBJECT_ERROR)
+            return
+        end if
+
+        ! Collect the key-value pairs
+        n = x%get_count()
+        allocate(keys(n), values(n), stat = flag)
+        if (flag /= 0) then
+            call errmgr%report_error("cd_merge_dict", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+        do i = 1, n
+            keys(i) = 0
+            item => x%m_list%get(i)
+            select type (item)
+                class is (key_value_pair)
+                    keys(i) = item%key
+                    values(i)%item => item%value
+            end select
+        end do
+
+        ! Process
+        call cd_merge_pairs(this, keys, values, replace, errmgr)
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Merges the contents of another concurrent_dictionary into this
+    !! dictionary.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    !! @param[in] x The dictionary to merge into this dictionary.
+    !! @param[in] overwrite An optional input determining if items in @p x
+    !!  replace items with matching keys already stored in this dictionary.
+    !!  The default is false, such that existing items are retained.
+    !! @param[in,out] err An optional errors-based object that if provided can be
+    !!  used to retrieve information relating to any errors encountered during
+    !!  execution.  If not provided, a default implementation of the errors
+    !!  class is used internally to provide error handling.  Possible errors and
+    !!  warning messages that may be encountered are as follows.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory.
+    !!  - FCORE_UNINITIALIZED_OBJECT_ERROR: Occurs if the dictionary has not
+    !!      been initialized.
+    module subroutine cd_merge_cdict(this, x, overwrite, err)
+        ! Arguments
+        class(concurrent_dictionary), intent(inout) :: this
+        class(concurrent_dictionary), intent(in) :: x
+        logical, intent(in), optional :: overwrite
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: i, j, n, s, flag
+        logical :: replace
+        integer(int64), allocatable, dimension(:) :: keys
+        type(container), allocatable, dimension(:) :: values
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        replace = .false.
+        if (present(overwrite)) replace = overwrite
+
+        ! Ensure the dictionary is initialized
+        if (this%m_shardCount == 0) then
+            call errmgr%report_error("cd_merge_cdict", &
+                "The dictionary has not been initialized.", &
+                FCORE_UNINITIALIZED_OBJECT_ERROR)
+            return
+        end if
+
+        ! Collect the key-value pairs
+        n = 0
+        do s = 1, x%m_shardCount
+            n = n + x%m_shards(s)%count
+        end do
+        allocate(keys(n), values(n), stat = flag)
+        if (flag /= 0) then
+            call errmgr%report_error("cd_merge_cdict", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+        j = 0
+        do s = 1, x%m_shardCount
+            associate (shard => x%m_shards(s))
+                do i = 1, size(shard%states)
+                    if (shard%states(i) /= SLOT_OCCUPIED) cycle
+                    j = j + 1
+                    keys(j) = shard%keys(i)
+                    values(j)%item => shard%values(i)%item
+                end do
+            end associate
+        end do
+
+        ! Process
+        call cd_merge_pairs(this, keys, values, replace, errmgr)
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Cleans up resources held by the dictionary.
+    !!
+    !! @param[in,out] this The concurrent_dictionary object.
+    module subroutine cd_final(this)
+        type(concurrent_dictionary), intent(inout) :: this
+        call cd_free(this)
+    end subroutine
+
+! ------------------------------------------------------------------------------
+end submodule
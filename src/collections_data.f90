@@ -25,6 +25,9 @@ contains
         deallocate(this%m_table)
 
         if (allocated(this%m_headers)) deallocate(this%m_headers)
+        if (allocated(this%m_indexes)) deallocate(this%m_indexes)
+        if (allocated(this%m_headerMap)) deallocate(this%m_headerMap)
+        if (allocated(this%m_headerHashes)) deallocate(this%m_headerHashes)
     end subroutine
 
 ! ------------------------------------------------------------------------------
@@ -97,6 +100,7 @@ contains
         ! Allocate space for the headers
         allocate(this%m_headers(n), stat = flag)
         if (flag /= 0) go to 100
+        call this%build_header_map(errmgr)
 
         return
     100 continue
@@ -202,6 +206,7 @@ contains
         end if
 
         ! Clear the existing item, and store the new item
+        call this%unindex_item(i, j)
         if (associated(this%m_table(i,j)%item)) then
             deallocate(this%m_table(i,j)%item)
         end if
@@ -212,6 +217,7 @@ contains
             return
         end if
         this%m_table(i, j)%item => cpy
+        call this%index_item(i, j)
     end subroutine
 
 ! ------------------------------------------------------------------------------
@@ -311,6 +317,9 @@ contains
                 k = k + 1
             end do
         end do
+
+        ! The row numbering has changed, so rebuild any column indexes
+        call this%rebuild_indexes(errmgr)
         
         return
     100 continue
@@ -368,6 +377,7 @@ contains
         integer(int32) :: i, j, k, m, n, nnew, flag
         type(container), allocatable, dimension(:,:) :: copy
         type(string), allocatable, dimension(:) :: hcopy
+        type(column_index), allocatable, dimension(:) :: icopy
         class(errors), pointer :: errmgr
         type(errors), target :: deferr
         character(len = 256) :: errmsg
@@ -473,6 +483,16 @@ contains
             k = k + 1
         end do
 
+        ! Shift any column indexes to match the new column numbering
+        if (allocated(this%m_indexes)) then
+            allocate(icopy(nnew), stat = flag)
+            if (flag /= 0) go to 100
+            icopy(1:cstart-1) = this%m_indexes(1:cstart-1)
+            icopy(cstart+size(x,2):nnew) = this%m_indexes(cstart:n)
+            call move_alloc(icopy, this%m_indexes)
+        end if
+        call this%build_header_map(errmgr)
+
         return
     100 continue
         ! Deal with memory errors
@@ -666,6 +686,9 @@ contains
             end do
         end do
 
+        ! The row numbering has changed, so rebuild any column indexes
+        call this%rebuild_indexes(errmgr)
+
         return
     100 continue
         ! Handle any memory errors
@@ -685,6 +708,7 @@ contains
         integer(int32) :: i, j, k, m, n, nnew, flag
         type(container), allocatable, dimension(:,:) :: copy
         type(string), allocatable, dimension(:) :: hcopy
+        type(column_index), allocatable, dimension(:) :: icopy
         class(errors), pointer :: errmgr
         type(errors), target :: deferr
         character(len = 256) :: errmsg
@@ -798,6 +822,16 @@ contains
             k = k + 1
         end do
 
+        ! Drop any indexes of the removed columns
+        if (allocated(this%m_indexes)) then
+            allocate(icopy(nnew), stat = flag)
+            if (flag /= 0) go to 100
+            icopy(1:cstart-1) = this%m_indexes(1:cstart-1)
+            icopy(cstart:nnew) = this%m_indexes(cstart+ncols:n)
+            call move_alloc(icopy, this%m_indexes)
+        end if
+        call this%build_header_map(errmgr)
+
         return
     100 continue
         ! Handle any memory errors
@@ -933,28 +967,10 @@ contains
         end if
 
         ! Process
+        call this%unmap_header(i)
         this%m_headers(i)%str = x
+        call this%map_header(i)
     end subroutine
 
-! ------------------------------------------------------------------------------
-    pure module function dt_get_column_index(this, hdr) result(rst)
-        ! Arguments
-        class(data_table), intent(in) :: this
-        character(len = *), intent(in) :: hdr
-        integer(int32) :: rst
-
-        ! Local Variables
-        integer(int32) :: i
-
-        ! Process
-        rst = 0
-        do i = 1, this%get_column_count()
-            if (this%m_headers(i)%str == hdr) then
-                rst = i
-                exit
-            end if
-        end do
-    end function
-
 ! ------------------------------------------------------------------------------
 end submodule
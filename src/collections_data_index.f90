@@ -0,0 +1,963 @@
+! collections_data_index.f90
+
+submodule (collections) collections_data_index
+    use fcore_constants
+    implicit none
+
+    !> @brief The minimum number of buckets in a hash index, or slots in the
+    !! header map.  This must be a power of two.
+    integer(int32), parameter :: MIN_BUCKET_COUNT = 16
+    !> @brief The 64-bit FNV-1a offset basis (0xCBF29CE484222325).
+    integer(int64), parameter :: FNV_OFFSET = -3750763034362895579_int64
+    !> @brief The 64-bit FNV-1a prime.
+    integer(int64), parameter :: FNV_PRIME = 1099511628211_int64
+contains
+! ******************************************************************************
+! PRIVATE HELPER ROUTINES
+! ------------------------------------------------------------------------------
+    !> @brief Computes the hash of a string.  Trailing blanks are ignored to
+    !! remain consistent with the intrinsic string comparison.
+    !!
+    !! @param[in] x The string.
+    !! @return The hash.
+    pure function hash_text(x) result(rst)
+        ! Arguments
+        character(len = *), intent(in) :: x
+        integer(int64) :: rst
+
+        ! Local Variables
+        integer(int32) :: i
+
+        ! Process
+        rst = FNV_OFFSET
+        do i = 1, len_trim(x)
+            rst = ieor(rst, int(ichar(x(i:i)), int64))
+            rst = rst * FNV_PRIME
+        end do
+        rst = mix_hash(rst)
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Computes the hash of a numeric value.  All numeric types are
+    !! hashed via their double-precision representation such that equal
+    !! values of differing kinds share the same hash.
+    !!
+    !! @param[in] x The value.
+    !! @return The hash.
+    pure function hash_real(x) result(rst)
+        ! Arguments
+        real(real64), intent(in) :: x
+        integer(int64) :: rst
+
+        ! Local Variables
+        real(real64) :: y
+
+        ! Process - adding zero maps -0 onto +0
+        y = x + 0.0d0
+        rst = mix_hash(transfer(y, rst))
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Computes the hash of an item.
+    !!
+    !! @param[in] x The item.
+    !! @return The hash.  Items of unsupported types all return a value of 0.
+    pure function hash_item(x) result(rst)
+        ! Arguments
+        class(*), intent(in) :: x
+        integer(int64) :: rst
+
+        ! Process
+        select type (x)
+        type is (integer(int8))
+            rst = hash_real(real(x, real64))
+        type is (integer(int16))
+            rst = hash_real(real(x, real64))
+        type is (integer(int32))
+            rst = hash_real(real(x, real64))
+        type is (integer(int64))
+            rst = hash_real(real(x, real64))
+        type is (real(real32))
+            rst = hash_real(real(x, real64))
+        type is (real(real64))
+            rst = hash_real(x)
+        type is (complex(real32))
+            rst = ieor(hash_real(real(x, real64)), &
+                mix_hash(hash_real(real(aimag(x), real64))))
+        type is (complex(real64))
+            rst = ieor(hash_real(real(x, real64)), &
+                mix_hash(hash_real(aimag(x))))
+        type is (logical)
+            rst = merge(1_int64, 2_int64, x)
+        type is (character(len = *))
+            rst = hash_text(x)
+        type is (string)
+            if (allocated(x%str)) then
+                rst = hash_text(x%str)
+            else
+                rst = hash_text("")
+            end if
+        class default
+            rst = 0
+        end select
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Computes the smallest power of two not less than twice the
+    !! requested size.
+    !!
+    !! @param[in] n The requested size.
+    !! @return The capacity.
+    pure function table_capacity(n) result(rst)
+        ! Arguments
+        integer(int32), intent(in) :: n
+        integer(int32) :: rst
+
+        ! Process
+        rst = MIN_BUCKET_COUNT
+        do while (rst < 2 * n)
+            rst = 2 * rst
+        end do
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Gets the bucket, or slot, responsible for the specified hash.
+    !!
+    !! @param[in] h The hash.
+    !! @param[in] n The number of buckets.  This must be a power of two.
+    !! @return The bucket index.
+    pure function bucket_index(h, n) result(rst)
+        ! Arguments
+        integer(int64), intent(in) :: h
+        integer(int32), intent(in) :: n
+        integer(int32) :: rst
+
+        ! Process
+        rst = int(iand(h, int(n - 1, int64)), int32) + 1
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Builds the hash index for the specified column.  The equality
+    !! function must already be assigned.
+    !!
+    !! @param[in,out] this The data_table object.
+    !! @param[in] j The column index.
+    !! @param[out] flag The allocation status.
+    subroutine hash_column(this, j, flag)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: j
+        integer(int32), intent(out) :: flag
+
+        ! Local Variables
+        integer(int32) :: i, b, m, nb
+
+        ! Initialization
+        m = this%get_row_count()
+        nb = table_capacity(m / 2)
+        associate (idx => this%m_indexes(j))
+            if (allocated(idx%hashes)) deallocate(idx%hashes)
+            if (allocated(idx%buckets)) deallocate(idx%buckets)
+            if (allocated(idx%next)) deallocate(idx%next)
+            allocate(idx%hashes(m), idx%buckets(nb), idx%next(m), stat = flag)
+            if (flag /= 0) return
+            idx%hashes = 0
+            idx%buckets = 0
+            idx%next = 0
+
+            ! Process - prepending in reverse leaves each bucket in ascending
+            ! row order
+            do i = m, 1, -1
+                if (.not.associated(this%m_table(i, j)%item)) cycle
+                idx%hashes(i) = hash_item(this%m_table(i, j)%item)
+                b = bucket_index(idx%hashes(i), nb)
+                idx%next(i) = idx%buckets(b)
+                idx%buckets(b) = i
+            end do
+        end associate
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Releases the hash index for the specified column.
+    !!
+    !! @param[in,out] idx The column_index object.
+    subroutine clear_hash(idx)
+        type(column_index), intent(inout) :: idx
+        nullify(idx%equals)
+        if (allocated(idx%hashes)) deallocate(idx%hashes)
+        if (allocated(idx%buckets)) deallocate(idx%buckets)
+        if (allocated(idx%next)) deallocate(idx%next)
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Builds the sorted index for the specified column.  The
+    !! comparison function must already be assigned.
+    !!
+    !! @param[in,out] this The data_table object.
+    !! @param[in] j The column index.
+    !! @param[out] flag The allocation status.
+    subroutine sort_column(this, j, flag)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: j
+        integer(int32), intent(out) :: flag
+
+        ! Local Variables
+        integer(int32) :: i, n, width, lo, mid, hi, a, b, k
+        integer(int32), allocatable, dimension(:) :: work
+
+        ! Initialization
+        associate (idx => this%m_indexes(j))
+            if (allocated(idx%order)) deallocate(idx%order)
+            allocate(idx%order(this%get_row_count()), &
+                work(this%get_row_count()), stat = flag)
+            if (flag /= 0) return
+
+            n = 0
+            do i = 1, this%get_row_count()
+                if (.not.associated(this%m_table(i, j)%item)) cycle
+                n = n + 1
+                idx%order(n) = i
+            end do
+            idx%count = n
+
+            ! Process - a bottom-up merge sort keeps rows holding equal values
+            ! in ascending order
+            width = 1
+            do while (width < n)
+                lo = 1
+                do while (lo <= n - width)
+                    mid = lo + width - 1
+                    hi = min(lo + 2 * width - 1, n)
+                    a = lo
+                    b = mid + 1
+                    do k = lo, hi
+                        if (b > hi) then
+                            work(k) = idx%order(a)
+                            a = a + 1
+                        else if (a > mid) then
+                            work(k) = idx%order(b)
+                            b = b + 1
+                        else if (idx%compare( &
+                            this%m_table(idx%order(a), j)%item, &
+                            this%m_table(idx%order(b), j)%item) <= 0) &
+                        then
+                            work(k) = idx%order(a)
+                            a = a + 1
+                        else
+                            work(k) = idx%order(b)
+                            b = b + 1
+                        end if
+                    end do
+                    idx%order(lo:hi) = work(lo:hi)
+                    lo = lo + 2 * width
+                end do
+                width = 2 * width
+            end do
+        end associate
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Releases the sorted index for the specified column.
+    !!
+    !! @param[in,out] idx The column_index object.
+    subroutine clear_sorted(idx)
+        type(column_index), intent(inout) :: idx
+        nullify(idx%compare)
+        if (allocated(idx%order)) deallocate(idx%order)
+        idx%count = 0
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Locates the first position in a sorted index whose item is not
+    !! less than (or, optionally, is greater than) the specified key.
+    !!
+    !! @param[in] this The data_table object.
+    !! @param[in] j The column index.
+    !! @param[in] key The search key.
+    !! @param[in] upper Set to true to locate the first item greater than
+    !!  @p key.
+    !! @return The position, or one past the last item if no such item
+    !!  exists.
+    function sorted_bound(this, j, key, upper) result(rst)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        integer(int32), intent(in) :: j
+        class(*), intent(in) :: key
+        logical, intent(in) :: upper
+        integer(int32) :: rst
+
+        ! Local Variables
+        integer(int32) :: hi, mid, c
+
+        ! Process
+        associate (idx => this%m_indexes(j))
+            rst = 1
+            hi = idx%count + 1
+            do while (rst < hi)
+                mid = rst + (hi - rst) / 2
+                c = idx%compare(this%m_table(idx%order(mid), j)%item, key)
+                if (c < 0 .or. (upper .and. c == 0)) then
+                    rst = mid + 1
+                else
+                    hi = mid
+                end if
+            end do
+        end associate
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Locates the position of a row within a run of rows holding equal
+    !! values in a sorted index.
+    !!
+    !! @param[in] order The sorted rows.
+    !! @param[in] lo The first position of the run.
+    !! @param[in] hi One past the last position of the run.
+    !! @param[in] row The row to locate.
+    !! @return The first position in the run whose row is not less than
+    !!  @p row.
+    pure function row_bound(order, lo, hi, row) result(rst)
+        ! Arguments
+        integer(int32), intent(in), dimension(:) :: order
+        integer(int32), intent(in) :: lo, hi, row
+        integer(int32) :: rst
+
+        ! Local Variables
+        integer(int32) :: upper, mid
+
+        ! Process
+        rst = lo
+        upper = hi
+        do while (rst < upper)
+            mid = rst + (upper - rst) / 2
+            if (order(mid) < row) then
+                rst = mid + 1
+            else
+                upper = mid
+            end if
+        end do
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Searches a hash index for the specified item.
+    !!
+    !! @param[in] this The data_table object.
+    !! @param[in] j The column index.
+    !! @param[in] item The item to search for.
+    !! @return The first row holding @p item, or 0 if not found.
+    function hash_lookup(this, j, item) result(rst)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        integer(int32), intent(in) :: j
+        class(*), intent(in) :: item
+        integer(int32) :: rst
+
+        ! Local Variables
+        integer(int64) :: h
+
+        ! Process
+        associate (idx => this%m_indexes(j))
+            h = hash_item(item)
+            rst = idx%buckets(bucket_index(h, size(idx%buckets)))
+            do while (rst /= 0)
+                if (idx%hashes(rst) == h) then
+                    if (idx%equals(item, this%m_table(rst, j)%item)) return
+                end if
+                rst = idx%next(rst)
+            end do
+        end associate
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Determines if the indexes of a column are current such that they
+    !! can be used, or incrementally updated.
+    !!
+    !! @par Remarks
+    !! While rows or columns are being inserted, the table is resized prior to
+    !! the indexes; the indexes are brought back in line by the inserting
+    !! routine once it completes.
+    !!
+    !! @param[in] this The data_table object.
+    !! @param[in] j The column index.
+    !! @param[out] hashed Returns true if the column has a current hash index.
+    !! @param[out] sorted Returns true if the column has a current sorted
+    !!  index.
+    pure subroutine index_state(this, j, hashed, sorted)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        integer(int32), intent(in) :: j
+        logical, intent(out) :: hashed, sorted
+
+        ! Process
+        hashed = .false.
+        sorted = .false.
+        if (.not.allocated(this%m_indexes)) return
+        if (size(this%m_indexes) /= this%get_column_count()) return
+        if (j < 1 .or. j > size(this%m_indexes)) return
+        associate (idx => this%m_indexes(j))
+            if (associated(idx%equals)) then
+                hashed = size(idx%next) == this%get_row_count()
+            end if
+            if (associated(idx%compare)) then
+                sorted = size(idx%order) == this%get_row_count()
+            end if
+        end associate
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Validates a column index supplied to one of the index routines.
+    !!
+    !! @param[in] this The data_table object.
+    !! @param[in] col The column index.
+    !! @param[in] fcn The name of the calling routine.
+    !! @param[in,out] errmgr The errors-based object.
+    subroutine check_column(this, col, fcn, errmgr)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        integer(int32), intent(in) :: col
+        character(len = *), intent(in) :: fcn
+        class(errors), intent(inout) :: errmgr
+
+        ! Local Variables
+        character(len = 256) :: errmsg
+
+        ! Process
+        if (.not.allocated(this%m_table)) then
+            call errmgr%report_error(fcn, &
+                "The table has not been initialized.", &
+                FCORE_UNINITIALIZED_OBJECT_ERROR)
+            return
+        end if
+        if (col <= 0 .or. col > this%get_column_count()) then
+            write(errmsg, '(AI0AI0A)') "Column index outside the bounds " // &
+                "of the array.  Found: ", col, &
+                ", but must lie between 1 and ", this%get_column_count(), "."
+            call errmgr%report_error(fcn, trim(errmsg), &
+                FCORE_INDEX_OUT_OF_RANGE_ERROR)
+            return
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Ensures the index collection matches the table structure.
+    !!
+    !! @param[in,out] this The data_table object.
+    !! @param[out] flag The allocation status.
+    subroutine allocate_indexes(this, flag)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(out) :: flag
+
+        ! Process
+        flag = 0
+        if (allocated(this%m_indexes)) then
+            if (size(this%m_indexes) == this%get_column_count()) return
+            deallocate(this%m_indexes)
+        end if
+        allocate(this%m_indexes(this%get_column_count()), stat = flag)
+    end subroutine
+
+! ******************************************************************************
+! INDEX ROUTINES
+! ------------------------------------------------------------------------------
+    module subroutine dt_build_hash_index(this, col, fcn, err)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: col
+        procedure(items_equal), pointer, intent(in) :: fcn
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Set up error handling
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Input Check
+        call check_column(this, col, "dt_build_hash_index", errmgr)
+        if (errmgr%has_error_occurred()) return
+        if (.not.associated(fcn)) then
+            call errmgr%report_error("dt_build_hash_index", &
+                "The comparison function is not associated.", &
+                FCORE_NULL_REFERENCE_ERROR)
+            return
+        end if
+
+        ! Process
+        call allocate_indexes(this, flag)
+        if (flag /= 0) go to 100
+        this%m_indexes(col)%equals => fcn
+        call hash_column(this, col, flag)
+        if (flag /= 0) then
+            call clear_hash(this%m_indexes(col))
+            go to 100
+        end if
+
+        return
+    100 continue
+        call errmgr%report_error("dt_build_hash_index", &
+            "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        return
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    module subroutine dt_build_sorted_index(this, col, fcn, err)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: col
+        procedure(compare_items), pointer, intent(in) :: fcn
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Set up error handling
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Input Check
+        call check_column(this, col, "dt_build_sorted_index", errmgr)
+        if (errmgr%has_error_occurred()) return
+        if (.not.associated(fcn)) then
+            call errmgr%report_error("dt_build_sorted_index", &
+                "The comparison function is not associated.", &
+                FCORE_NULL_REFERENCE_ERROR)
+            return
+        end if
+
+        ! Process
+        call allocate_indexes(this, flag)
+        if (flag /= 0) go to 100
+        this%m_indexes(col)%compare => fcn
+        call sort_column(this, col, flag)
+        if (flag /= 0) then
+            call clear_sorted(this%m_indexes(col))
+            go to 100
+        end if
+
+        return
+    100 continue
+        call errmgr%report_error("dt_build_sorted_index", &
+            "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        return
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    module subroutine dt_remove_indexes(this, col, err)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: col
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Set up error handling
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Input Check
+        call check_column(this, col, "dt_remove_indexes", errmgr)
+        if (errmgr%has_error_occurred()) return
+
+        ! Process
+        if (.not.allocated(this%m_indexes)) return
+        call clear_hash(this%m_indexes(col))
+        call clear_sorted(this%m_indexes(col))
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    pure module function dt_has_hash_index(this, col) result(rst)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        integer(int32), intent(in) :: col
+        logical :: rst
+
+        ! Local Variables
+        logical :: sorted
+
+        ! Process
+        call index_state(this, col, rst, sorted)
+    end function
+
+! ------------------------------------------------------------------------------
+    pure module function dt_has_sorted_index(this, col) result(rst)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        integer(int32), intent(in) :: col
+        logical :: rst
+
+        ! Local Variables
+        logical :: hashed
+
+        ! Process
+        call index_state(this, col, hashed, rst)
+    end function
+
+! ------------------------------------------------------------------------------
+    module function dt_find(this, col, item, err) result(rst)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        integer(int32), intent(in) :: col
+        class(*), intent(in) :: item
+        class(errors), intent(inout), optional, target :: err
+        integer(int32) :: rst
+
+        ! Local Variables
+        integer(int32) :: p
+        logical :: hashed, sorted
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Set up error handling
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Input Check
+        rst = 0
+        call check_column(this, col, "dt_find", errmgr)
+        if (errmgr%has_error_occurred()) return
+        call index_state(this, col, hashed, sorted)
+
+        ! Process
+        if (hashed) then
+            rst = hash_lookup(this, col, item)
+        else if (sorted) then
+            associate (idx => this%m_indexes(col))
+                p = sorted_bound(this, col, item, .false.)
+                if (p <= idx%count) then
+                    if (idx%compare(this%m_table(idx%order(p), col)%item, &
+                        item) == 0) rst = idx%order(p)
+                end if
+            end associate
+        else
+            call errmgr%report_error("dt_find", &
+                "The column has not been indexed.", &
+                FCORE_UNINITIALIZED_OBJECT_ERROR)
+        end if
+    end function
+
+! ------------------------------------------------------------------------------
+    module function dt_find_range(this, col, lower, upper, err) result(rst)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        integer(int32), intent(in) :: col
+        class(*), intent(in) :: lower, upper
+        class(errors), intent(inout), optional, target :: err
+        integer(int32), allocatable, dimension(:) :: rst
+
+        ! Local Variables
+        integer(int32) :: p1, p2
+        logical :: hashed, sorted
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Set up error handling
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Input Check
+        allocate(rst(0))
+        call check_column(this, col, "dt_find_range", errmgr)
+        if (errmgr%has_error_occurred()) return
+        call index_state(this, col, hashed, sorted)
+        if (.not.sorted) then
+            call errmgr%report_error("dt_find_range", &
+                "The column does not have a sorted index.", &
+                FCORE_UNINITIALIZED_OBJECT_ERROR)
+            return
+        end if
+
+        ! Process
+        p1 = sorted_bound(this, col, lower, .false.)
+        p2 = sorted_bound(this, col, upper, .true.) - 1
+        if (p2 >= p1) rst = this%m_indexes(col)%order(p1:p2)
+    end function
+
+! ------------------------------------------------------------------------------
+    module subroutine dt_unindex_item(this, i, j)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: i, j
+
+        ! Local Variables
+        integer(int32) :: b, k, prev, p1, p2, n
+        logical :: hashed, sorted
+
+        ! Quick Return
+        if (.not.associated(this%m_table(i, j)%item)) return
+        call index_state(this, j, hashed, sorted)
+        if (.not.hashed .and. .not.sorted) return
+
+        ! Process
+        associate (idx => this%m_indexes(j))
+            if (hashed) then
+                b = bucket_index(idx%hashes(i), size(idx%buckets))
+                prev = 0
+                k = idx%buckets(b)
+                do while (k /= 0 .and. k < i)
+                    prev = k
+                    k = idx%next(k)
+                end do
+                if (k == i) then
+                    if (prev == 0) then
+                        idx%buckets(b) = idx%next(i)
+                    else
+                        idx%next(prev) = idx%next(i)
+                    end if
+                    idx%next(i) = 0
+                end if
+            end if
+
+            if (sorted) then
+                n = idx%count
+                p1 = sorted_bound(this, j, this%m_table(i, j)%item, .false.)
+                p2 = sorted_bound(this, j, this%m_table(i, j)%item, .true.)
+                k = row_bound(idx%order, p1, p2, i)
+                if (k < p2) then
+                    if (idx%order(k) == i) then
+                        idx%order(k:n-1) = idx%order(k+1:n)
+                        idx%count = n - 1
+                    end if
+                end if
+            end if
+        end associate
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    module subroutine dt_index_item(this, i, j)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: i, j
+
+        ! Local Variables
+        integer(int32) :: b, k, prev, p1, p2, n
+        logical :: hashed, sorted
+
+        ! Quick Return
+        if (.not.associated(this%m_table(i, j)%item)) return
+        call index_state(this, j, hashed, sorted)
+        if (.not.hashed .and. .not.sorted) return
+
+        ! Process
+        associate (idx => this%m_indexes(j))
+            if (hashed) then
+                idx%hashes(i) = hash_item(this%m_table(i, j)%item)
+                b = bucket_index(idx%hashes(i), size(idx%buckets))
+                prev = 0
+                k = idx%buckets(b)
+                do while (k /= 0 .and. k < i)
+                    prev = k
+                    k = idx%next(k)
+                end do
+                idx%next(i) = k
+                if (prev == 0) then
+                    idx%buckets(b) = i
+                else
+                    idx%next(prev) = i
+                end if
+            end if
+
+            if (sorted) then
+                n = idx%count
+                p1 = sorted_bound(this, j, this%m_table(i, j)%item, .false.)
+                p2 = sorted_bound(this, j, this%m_table(i, j)%item, .true.)
+                k = row_bound(idx%order, p1, p2, i)
+                idx%order(k+1:n+1) = idx%order(k:n)
+                idx%order(k) = i
+                idx%count = n + 1
+            end if
+        end associate
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    module subroutine dt_rebuild_indexes(this, err)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        class(errors), intent(inout) :: err
+
+        ! Local Variables
+        integer(int32) :: j, flag
+
+        ! Quick Return
+        if (.not.allocated(this%m_indexes)) return
+
+        ! Process - an index that cannot be rebuilt is dropped
+        do j = 1, size(this%m_indexes)
+            if (associated(this%m_indexes(j)%equals)) then
+                call hash_column(this, j, flag)
+                if (flag /= 0) then
+                    call clear_hash(this%m_indexes(j))
+                    go to 100
+                end if
+            end if
+            if (associated(this%m_indexes(j)%compare)) then
+                call sort_column(this, j, flag)
+                if (flag /= 0) then
+                    call clear_sorted(this%m_indexes(j))
+                    go to 100
+                end if
+            end if
+        end do
+
+        return
+    100 continue
+        call err%report_error("dt_rebuild_indexes", &
+            "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        return
+    end subroutine
+
+! ******************************************************************************
+! HEADER MAP ROUTINES
+! ------------------------------------------------------------------------------
+    module subroutine dt_build_header_map(this, err)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        class(errors), intent(inout) :: err
+
+        ! Local Variables
+        integer(int32) :: i, n, flag
+
+        ! Initialization
+        if (allocated(this%m_headerMap)) deallocate(this%m_headerMap)
+        if (allocated(this%m_headerHashes)) deallocate(this%m_headerHashes)
+        if (.not.allocated(this%m_headers)) return
+        n = size(this%m_headers)
+
+        ! Process - without a map, column lookups fall back on a linear search
+        allocate(this%m_headerMap(table_capacity(n)), &
+            this%m_headerHashes(n), stat = flag)
+        if (flag /= 0) then
+            if (allocated(this%m_headerMap)) deallocate(this%m_headerMap)
+            call err%report_error("dt_build_header_map", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+        this%m_headerMap = 0
+        this%m_headerHashes = 0
+        do i = 1, n
+            call this%map_header(i)
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    pure module subroutine dt_map_header(this, i)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: i
+
+        ! Local Variables
+        integer(int32) :: s, n
+
+        ! Quick Return - blank headers are not mapped
+        if (.not.allocated(this%m_headerMap)) return
+        if (.not.allocated(this%m_headers(i)%str)) return
+        if (len_trim(this%m_headers(i)%str) == 0) return
+
+        ! Process
+        n = size(this%m_headerMap)
+        this%m_headerHashes(i) = hash_text(this%m_headers(i)%str)
+        s = bucket_index(this%m_headerHashes(i), n)
+        do while (this%m_headerMap(s) /= 0)
+            s = mod(s, n) + 1
+        end do
+        this%m_headerMap(s) = i
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    pure module subroutine dt_unmap_header(this, i)
+        ! Arguments
+        class(data_table), intent(inout) :: this
+        integer(int32), intent(in) :: i
+
+        ! Local Variables
+        integer(int32) :: s, k, home, n
+
+        ! Locate the slot holding the column
+        if (.not.allocated(this%m_headerMap)) return
+        n = size(this%m_headerMap)
+        s = bucket_index(this%m_headerHashes(i), n)
+        do
+            if (this%m_headerMap(s) == 0) return
+            if (this%m_headerMap(s) == i) exit
+            s = mod(s, n) + 1
+        end do
+
+        ! Shift any following entries of the probe sequence back into the
+        ! vacated slot such that no empty slot interrupts their probe sequence
+        k = s
+        do
+            k = mod(k, n) + 1
+            if (this%m_headerMap(k) == 0) exit
+            home = bucket_index(this%m_headerHashes(this%m_headerMap(k)), n)
+            if (mod(k - home + n, n) >= mod(k - s + n, n)) then
+                this%m_headerMap(s) = this%m_headerMap(k)
+                s = k
+            end if
+        end do
+        this%m_headerMap(s) = 0
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    pure module function dt_get_column_index(this, hdr) result(rst)
+        ! Arguments
+        class(data_table), intent(in) :: this
+        character(len = *), intent(in) :: hdr
+        integer(int32) :: rst
+
+        ! Local Variables
+        integer(int32) :: i, s, n
+        integer(int64) :: h
+
+        ! Blank headers are not mapped, so search for them directly
+        rst = 0
+        if (.not.allocated(this%m_headerMap) .or. len_trim(hdr) == 0) then
+            do i = 1, this%get_column_count()
+                if (.not.allocated(this%m_headers(i)%str)) cycle
+                if (this%m_headers(i)%str == hdr) then
+                    rst = i
+                    exit
+                end if
+            end do
+            return
+        end if
+
+        ! Process - duplicate headers may be present, so walk the entire
+        ! probe sequence and return the first matching column
+        n = size(this%m_headerMap)
+        h = hash_text(hdr)
+        s = bucket_index(h, n)
+        do while (this%m_headerMap(s) /= 0)
+            i = this%m_headerMap(s)
+            if (this%m_headerHashes(i) == h) then
+                if (this%m_headers(i)%str == hdr) then
+                    if (rst == 0 .or. i < rst) rst = i
+                end if
+            end if
+            s = mod(s, n) + 1
+        end do
+    end function
+
+! ------------------------------------------------------------------------------
+end submodule
@@ -1,6 +1,9 @@
 ! collections_hash.f90
 
 submodule (collections) collections_hash
+    !> @brief The 64-bit golden ratio multiplier (0x9E3779B97F4A7C15) used to
+    !! scramble hashes.
+    integer(int64), parameter :: HASH_MULTIPLIER = -7046029254386353131_int64
 contains
 ! ******************************************************************************
 ! HASH_GENERATOR MEMBERS
@@ -66,5 +69,24 @@ contains
         rst = ieor(crc, this%finalxor)
     end function
 
+! ******************************************************************************
+! HASH MIXING
+! ------------------------------------------------------------------------------
+    !> @brief Scrambles a hash, or an integer key, such that both its upper
+    !! and lower bits are suitable for indexing.  This is shared by the 
+    !! hashed collections.
+    !!
+    !! @param[in] h The hash.
+    !! @return The scrambled hash.
+    pure module function mix_hash(h) result(rst)
+        ! Arguments
+        integer(int64), intent(in) :: h
+        integer(int64) :: rst
+
+        ! Process
+        rst = h * HASH_MULTIPLIER
+        rst = ieor(rst, ishft(rst, -32))
+    end function
+
 ! ------------------------------------------------------------------------------
 end submodule
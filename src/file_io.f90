@@ -7,12 +7,15 @@ module file_io
     use ferror
     use fcore_constants
     use strings
+    use collections, only : data_table
     implicit none
     private
     public :: file_manager
     public :: text_writer
+    public :: delimited_block_plan
     public :: file_reader
     public :: text_reader
+    public :: text_buffer
     public :: binary_writer
     public :: binary_reader
     public :: is_little_endian
@@ -183,11 +186,66 @@ module file_io
         !!  - FCORE_UNOPENED_ERROR: Occurs if the file has not yet been opened.
         generic, public :: write_line => tw_write_txt_line, &
             tw_write_txt_line_str
+        !> @brief Writes a matrix or data_table to the file as delimited text
+        !! (e.g. CSV), with one row of the file per row of the matrix or
+        !! table.
+        !!
+        !! @par Syntax #1
+        !! @code{.f90}
+        !! subroutine write_delimited(class(text_writer) this, real(real64) x(:,:), character(len = *) delim, character(len = *) fmt, class(errors) err)
+        !! @endcode
+        !!
+        !! @par Syntax #2
+        !! @code{.f90}
+        !! subroutine write_delimited(class(text_writer) this, integer(int64) x(:,:), character(len = *) delim, character(len = *) fmt, class(errors) err)
+        !! @endcode
+        !!
+        !! @par Syntax #3
+        !! @code{.f90}
+        !! subroutine write_delimited(class(text_writer) this, class(data_table) x, character(len = *) delim, character(len = *) fmt, logical header, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in] this The text_writer object.
+        !! @param[in] x The matrix or data_table to write.
+        !! @param[in] delim An optional input specifying the delimiter to 
+        !!  place between values on each row.  The default is a comma.
+        !! @param[in] fmt An optional Fortran format string (e.g. "(ES14.6)")
+        !!  used to format each numeric value.  If not supplied, 
+        !!  floating-point values are written using the shortest 
+        !!  representation that reads back to the exact same value, and 
+        !!  integer values are written without padding.  If a data_table is
+        !!  supplied, this format is applied only to the floating-point 
+        !!  values within the table.
+        !! @param[in] header An optional input that determines if the column
+        !!  headers of the data_table should be written as the first row of
+        !!  the file.  The default is true.
+        !! @param[in,out] err An optional errors-based object that if provided
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_UNOPENED_ERROR: Occurs if the file has not yet been opened.
+        !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be written.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there isn't sufficient memory
+        !!      available.
+        !!
+        !! @par Remarks
+        !! The rows are formatted in blocks, in parallel, with each block 
+        !! written to the file in a single operation.  Text within a 
+        !! data_table that contains the delimiter, a quotation mark, or a line
+        !! break is enclosed in quotation marks, with any embedded quotation
+        !! marks doubled.
+        generic, public :: write_delimited => tw_write_delim_r64, &
+            tw_write_delim_i64, tw_write_delim_table
 
         procedure :: tw_write_txt
         procedure :: tw_write_txt_str
         procedure :: tw_write_txt_line
         procedure :: tw_write_txt_line_str
+        procedure :: tw_write_delim_r64
+        procedure :: tw_write_delim_i64
+        procedure :: tw_write_delim_table
     end type
 
 ! ------------------------------------------------------------------------------
@@ -365,6 +423,141 @@ module file_io
         procedure, public :: read_lines => tr_read_lines
     end type
 
+! ------------------------------------------------------------------------------
+    !> @brief Defines a line-indexed buffer containing the contents of a text
+    !! file.  The contents are stored only once, along with the starting 
+    !! location of each line, such that any line may be accessed directly
+    !! without the need to allocate storage for each individual line.
+    type text_buffer
+    private
+        !> @brief The contents of the file.
+        character(len = :), allocatable :: m_contents
+        !> @brief An array containing the starting index of each line within
+        !! m_contents.  An additional trailing entry is stored such that the
+        !! extent of line i is always bounded by entries i and i + 1.
+        integer(int64), allocatable, dimension(:) :: m_lines
+        !> @brief The number of lines.
+        integer(int64) :: m_count = 0
+    contains
+        !> @brief Reads the entire contents of an ASCII text file into the 
+        !! buffer, and indexes the start of each line.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine load(class(text_buffer) this, character(len = *) fname, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The text_buffer object.
+        !! @param[in] fname The name of the file to read.
+        !! @param[in,out] err An optional errors-based object that if provided
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be opened or
+        !!      read.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there isn't sufficient memory
+        !!      available.
+        !!
+        !! @par Remarks
+        !! The lines are defined in the same manner as 
+        !! @ref text_reader::read_lines.  Lines are terminated by a new line 
+        !! character, a trailing carriage return is not considered part of the
+        !! line, and any empty lines at the end of the file are ignored.  For
+        !! sufficiently large files, the line index is constructed in parallel.
+        procedure, public :: load => tb_load
+        !> @brief Copies the supplied text into the buffer, and indexes the 
+        !! start of each line.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine set_text(class(text_buffer) this, character(len = *) txt, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The text_buffer object.
+        !! @param[in] txt The text.
+        !! @param[in,out] err An optional errors-based object that if provided
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there isn't sufficient memory
+        !!      available.
+        procedure, public :: set_text => tb_set_text
+        !> @brief Gets the number of lines in the buffer.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! pure integer(int64) get_count(class(text_buffer) this)
+        !! @endcode
+        !!
+        !! @param[in] this The text_buffer object.
+        !! @return The number of lines.
+        procedure, public :: get_count => tb_get_count
+        !> @brief Gets the length of the requested line, not including any
+        !! line termination characters.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! pure integer(int64) get_line_length(class(text_buffer) this, integer(int64) i)
+        !! @endcode
+        !!
+        !! @param[in] this The text_buffer object.
+        !! @param[in] i The one-based index of the line.
+        !! @return The length of the line.  If @p i is out of range, zero is
+        !!  returned.
+        procedure, public :: get_line_length => tb_get_line_length
+        !> @brief Gets a copy of the requested line.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! character(len = :) get_line(class(text_buffer) this, integer(int64) i, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in] this The text_buffer object.
+        !! @param[in] i The one-based index of the line.
+        !! @param[in,out] err An optional errors-based object that if provided
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p i is outside the 
+        !!      bounds of the buffer.
+        !!
+        !! @return The line, without any line termination characters.
+        procedure, public :: get_line => tb_get_line
+        !> @brief Gets a pointer to the requested line as it is stored within
+        !! the buffer.  No copy is made.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! character(len = :), pointer get_line_view(class(text_buffer) this, integer(int64) i, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in] this The text_buffer object.  This object must be 
+        !!  declared with the target attribute.
+        !! @param[in] i The one-based index of the line.
+        !! @param[in,out] err An optional errors-based object that if provided
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p i is outside the 
+        !!      bounds of the buffer.
+        !!
+        !! @return A pointer to the line, without any line termination 
+        !!  characters.  If @p i is out of range, a null pointer is returned.
+        !!
+        !! @par Remarks
+        !! The pointer remains valid only until the contents of the buffer are
+        !! changed, or the buffer goes out of scope.
+        procedure, public :: get_line_view => tb_get_line_view
+    end type
+
 ! ------------------------------------------------------------------------------
     !> @brief Defines a mechanism for writing binary files.
     type, extends(file_reader) :: binary_writer
@@ -531,7 +724,15 @@ module file_io
 ! ------------------------------------------------------------------------------
     !> @brief Defines a mechanism for reading binary files.
     type, extends(file_reader) :: binary_reader
+    private
+        !> @brief A handle to the file used for positional (offset-based) 
+        !! reads.  Unlike the Fortran unit, this handle carries no file 
+        !! position, and may be shared by multiple threads.
+        type(c_ptr) :: m_handle = c_null_ptr
     contains
+        !> @brief Closes the file, and performs any necessary clean-up 
+        !! operations.
+        final :: br_clean_up
         !> @brief Opens a binary file for reading.
         !!
         !! @par Syntax
@@ -617,6 +818,141 @@ module file_io
         !!
         !! @result An array containing the results.
         procedure, public :: read_all => br_read_all
+        !> @brief Closes the file.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine close(class(binary_reader) this, logical del)
+        !! @endcode
+        !!
+        !! @param[in,out] this The binary_reader object.
+        !! @param[in] del An optional input, that if set, determines if the file
+        !!  should be deleted once closed.  The default is false such that the
+        !!  file remains.
+        procedure, public :: close => br_close
+        !> @brief Reads a range of bytes from the file without referencing or
+        !! altering the current position.  This routine is thread-safe, such 
+        !! that multiple threads may read different regions of the file 
+        !! concurrently.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! integer(int8)(:) read_at(class(binary_reader) this, integer(int64) pos, integer(int64) n, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in] this The binary_reader object.
+        !! @param[in] pos The file position (one-based) of the first byte to 
+        !!  read.
+        !! @param[in] n The number of bytes to read.
+        !! @param[in,out] err An optional errors-based object that if provided
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+        !!  - FCORE_INVALID_INPUT_ERROR: Occurs if @p pos is less than one, or
+        !!      if @p n is negative.
+        !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory
+        !!      available.
+        !!
+        !! @result An array containing the results.  If the requested range
+        !!  extends beyond the end of the file, only the bytes up to the end of
+        !!  the file are returned.
+        procedure, public :: read_at => br_read_at
+        !> @brief Reads the entire contents of the file into a buffer by 
+        !! splitting the file into ranges, and reading the ranges in parallel.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! integer(int8)(:) read_all_parallel(class(binary_reader) this, integer(int64) chunk, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in] this The binary_reader object.
+        !! @param[in] chunk An optional input specifying the size, in bytes, of
+        !!  each range.  The default is 8 MB.
+        !! @param[in,out] err An optional errors-based object that if provided
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+        !!  - FCORE_INVALID_INPUT_ERROR: Occurs if @p chunk is less than one.
+        !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+        !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory
+        !!      available.
+        !!
+        !! @result An array containing the results.
+        !!
+        !! @par Remarks
+        !! Notice, the position indicator is neither referenced nor altered by
+        !! this read operation.
+        procedure, public :: read_all_parallel => br_read_all_parallel
+        !> @brief Reads data from the file directly into an existing 
+        !! variable or array.  The number of bytes read is determined by the 
+        !! size of the supplied variable or array, and no memory is allocated.
+        !!
+        !! @par Syntax
+        !! @code{.f90}
+        !! subroutine read(class(binary_reader) this, generic x, logical swap, class(errors) err)
+        !! @endcode
+        !!
+        !! @param[in,out] this The binary_reader object.
+        !! @param[out] x The variable, array, or matrix to populate.  The 
+        !!  following types are supported: real(real64), real(real32),
+        !!  integer(int16), integer(int32), integer(int64), complex(real64),
+        !!  and complex(real32).
+        !! @param[in] swap An optional input that, if set to true, reverses 
+        !!  the byte order of each value once read.  This is useful when 
+        !!  reading files written on a machine of differing endianness.  The
+        !!  default is false.
+        !! @param[in,out] err An optional errors-based object that if provided
+        !!  can be used to retrieve information relating to any errors 
+        !!  encountered during execution.  If not provided, a default 
+        !!  implementation of the errors class is used internally to provide 
+        !!  error handling.  Possible errors and warning messages that may be 
+        !!  encountered are as follows.
+        !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+        !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+        !!      encountered before @p x is filled.
+        !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+        !!
+        !! @par Remarks
+        !! The read begins at the current position, and on output, the 
+        !! position indicator is incremented by the number of bytes read.  If
+        !! an error is encountered, the position is left unchanged.
+        generic, public :: read => &
+            br_read_r64, br_read_r64_array, br_read_r64_matrix, &
+            br_read_r32, br_read_r32_array, br_read_r32_matrix, &
+            br_read_i16, br_read_i16_array, br_read_i16_matrix, &
+            br_read_i32, br_read_i32_array, br_read_i32_matrix, &
+            br_read_i64, br_read_i64_array, br_read_i64_matrix, &
+            br_read_c64, br_read_c64_array, br_read_c64_matrix, &
+            br_read_c32, br_read_c32_array, br_read_c32_matrix
+
+        procedure :: br_read_r64
+        procedure :: br_read_r64_array
+        procedure :: br_read_r64_matrix
+        procedure :: br_read_r32
+        procedure :: br_read_r32_array
+        procedure :: br_read_r32_matrix
+        procedure :: br_read_i16
+        procedure :: br_read_i16_array
+        procedure :: br_read_i16_matrix
+        procedure :: br_read_i32
+        procedure :: br_read_i32_array
+        procedure :: br_read_i32_matrix
+        procedure :: br_read_i64
+        procedure :: br_read_i64_array
+        procedure :: br_read_i64_matrix
+        procedure :: br_read_c64
+        procedure :: br_read_c64_array
+        procedure :: br_read_c64_matrix
+        procedure :: br_read_c32
+        procedure :: br_read_c32_array
+        procedure :: br_read_c32_matrix
     end type
 
 ! ------------------------------------------------------------------------------
@@ -669,6 +1005,66 @@ module file_io
                 ndir, dirLengths(nbuffers)
             logical(c_bool) :: rst
         end function
+
+        !> @brief An interface to the C open_positional_file_c routine.
+        function open_positional_file_c(fname) result(rst) &
+                bind(C, name = "open_positional_file_c")
+            use iso_c_binding
+            character(kind = c_char), intent(in) :: fname(*)
+            type(c_ptr) :: rst
+        end function
+
+        !> @brief An interface to the C close_positional_file_c routine.
+        subroutine close_positional_file_c(handle) &
+                bind(C, name = "close_positional_file_c")
+            use iso_c_binding
+            type(c_ptr), intent(in), value :: handle
+        end subroutine
+
+        !> @brief An interface to the C positional_file_size_c routine.
+        function positional_file_size_c(handle) result(rst) &
+                bind(C, name = "positional_file_size_c")
+            use iso_c_binding
+            type(c_ptr), intent(in), value :: handle
+            integer(c_long_long) :: rst
+        end function
+
+        !> @brief An interface to the C read_positional_file_c routine.
+        function read_positional_file_c(handle, offset, n, buffer) &
+                result(rst) bind(C, name = "read_positional_file_c")
+            use iso_c_binding
+            type(c_ptr), intent(in), value :: handle
+            integer(c_long_long), intent(in), value :: offset, n
+            integer(c_signed_char), intent(out) :: buffer(*)
+            integer(c_long_long) :: rst
+        end function
+
+        !> @brief An interface to the C format_real64_c routine.
+        function format_real64_c(x, buffer) result(rst) &
+                bind(C, name = "format_real64_c")
+            use iso_c_binding
+            real(c_double), intent(in), value :: x
+            character(kind = c_char), intent(out) :: buffer(*)
+            integer(c_int) :: rst
+        end function
+
+        !> @brief An interface to the C format_real32_c routine.
+        function format_real32_c(x, buffer) result(rst) &
+                bind(C, name = "format_real32_c")
+            use iso_c_binding
+            real(c_float), intent(in), value :: x
+            character(kind = c_char), intent(out) :: buffer(*)
+            integer(c_int) :: rst
+        end function
+
+        !> @brief An interface to the C format_int64_c routine.
+        function format_int64_c(x, buffer) result(rst) &
+                bind(C, name = "format_int64_c")
+            use iso_c_binding
+            integer(c_long_long), intent(in), value :: x
+            character(kind = c_char), intent(out) :: buffer(*)
+            integer(c_int) :: rst
+        end function
     end interface
 
 ! ******************************************************************************
@@ -751,6 +1147,43 @@ module file_io
             class(string), intent(in) :: txt
             class(errors), intent(inout), optional, target :: err
         end subroutine
+
+        module subroutine tw_write_delim_r64(this, x, delim, fmt, err)
+            class(text_writer), intent(in) :: this
+            real(real64), intent(in), dimension(:,:) :: x
+            character(len = *), intent(in), optional :: delim, fmt
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine tw_write_delim_i64(this, x, delim, fmt, err)
+            class(text_writer), intent(in) :: this
+            integer(int64), intent(in), dimension(:,:) :: x
+            character(len = *), intent(in), optional :: delim, fmt
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine tw_write_delim_table(this, x, delim, fmt, header, &
+                err)
+            class(text_writer), intent(in) :: this
+            class(data_table), intent(in) :: x
+            character(len = *), intent(in), optional :: delim, fmt
+            logical, intent(in), optional :: header
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        !> @brief Determines how the rows of a matrix are split into blocks
+        !! when written by write_delimited.
+        !!
+        !! @param[in] m The number of rows.
+        !! @param[in] n The number of columns.
+        !! @param[out] rows The number of rows in each block.
+        !! @param[out] nblocks The total number of blocks.
+        !! @param[out] nbatch The number of blocks formatted before each 
+        !!  write to file.
+        module subroutine delimited_block_plan(m, n, rows, nblocks, nbatch)
+            integer(int32), intent(in) :: m, n
+            integer(int32), intent(out) :: rows, nblocks, nbatch
+        end subroutine
     end interface
 
 ! ------------------------------------------------------------------------------
@@ -808,6 +1241,46 @@ module file_io
         end function
     end interface
 
+! ------------------------------------------------------------------------------
+    interface
+        module subroutine tb_load(this, fname, err)
+            class(text_buffer), intent(inout) :: this
+            character(len = *), intent(in) :: fname
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine tb_set_text(this, txt, err)
+            class(text_buffer), intent(inout) :: this
+            character(len = *), intent(in) :: txt
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        pure module function tb_get_count(this) result(rst)
+            class(text_buffer), intent(in) :: this
+            integer(int64) :: rst
+        end function
+
+        pure module function tb_get_line_length(this, i) result(rst)
+            class(text_buffer), intent(in) :: this
+            integer(int64), intent(in) :: i
+            integer(int64) :: rst
+        end function
+
+        module function tb_get_line(this, i, err) result(rst)
+            class(text_buffer), intent(in) :: this
+            integer(int64), intent(in) :: i
+            class(errors), intent(inout), optional, target :: err
+            character(len = :), allocatable :: rst
+        end function
+
+        module function tb_get_line_view(this, i, err) result(rst)
+            class(text_buffer), intent(in), target :: this
+            integer(int64), intent(in) :: i
+            class(errors), intent(inout), optional, target :: err
+            character(len = :), pointer :: rst
+        end function
+    end interface
+
 ! ------------------------------------------------------------------------------
     interface
         pure module function bw_get_capacity(this) result(rst)
@@ -1027,6 +1500,176 @@ module file_io
             class(errors), intent(inout), optional, target :: err
             integer(int8), allocatable, dimension(:) :: rst
         end function
+
+        module subroutine br_close(this, del)
+            class(binary_reader), intent(inout) :: this
+            logical, intent(in), optional :: del
+        end subroutine
+
+        module subroutine br_clean_up(this)
+            type(binary_reader), intent(inout) :: this
+        end subroutine
+
+        module function br_read_at(this, pos, n, err) result(rst)
+            class(binary_reader), intent(in) :: this
+            integer(int64), intent(in) :: pos, n
+            class(errors), intent(inout), optional, target :: err
+            integer(int8), allocatable, dimension(:) :: rst
+        end function
+
+        module function br_read_all_parallel(this, chunk, err) result(rst)
+            class(binary_reader), intent(in) :: this
+            integer(int64), intent(in), optional :: chunk
+            class(errors), intent(inout), optional, target :: err
+            integer(int8), allocatable, dimension(:) :: rst
+        end function
+
+        module subroutine br_read_r64(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            real(real64), intent(out) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_r64_array(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            real(real64), intent(out), dimension(:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_r64_matrix(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            real(real64), intent(out), dimension(:,:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_r32(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            real(real32), intent(out) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_r32_array(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            real(real32), intent(out), dimension(:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_r32_matrix(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            real(real32), intent(out), dimension(:,:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i16(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int16), intent(out) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i16_array(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int16), intent(out), dimension(:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i16_matrix(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int16), intent(out), dimension(:,:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i32(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int32), intent(out) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i32_array(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int32), intent(out), dimension(:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i32_matrix(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int32), intent(out), dimension(:,:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i64(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int64), intent(out) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i64_array(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int64), intent(out), dimension(:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_i64_matrix(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            integer(int64), intent(out), dimension(:,:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_c64(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            complex(real64), intent(out) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_c64_array(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            complex(real64), intent(out), dimension(:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_c64_matrix(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            complex(real64), intent(out), dimension(:,:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_c32(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            complex(real32), intent(out) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_c32_array(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            complex(real32), intent(out), dimension(:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
+
+        module subroutine br_read_c32_matrix(this, x, swap, err)
+            class(binary_reader), intent(inout) :: this
+            complex(real32), intent(out), dimension(:,:) :: x
+            logical, intent(in), optional :: swap
+            class(errors), intent(inout), optional, target :: err
+        end subroutine
     end interface
 
 ! ------------------------------------------------------------------------------
@@ -973,7 +973,9 @@ contains
     !!  during execution.  If not provided, a default implementation of the 
     !!  errors class is used internally to provide error handling.  Possible 
     !!  errors and warning messages that may be encountered are as follows.
-    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be opened.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be opened, or
+    !!      if it could not be opened for positional access.  In either case
+    !!      the reader is left closed.
     !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory
     !!      available.
     module subroutine br_open(this, fname, err)
@@ -1007,10 +1009,21 @@ contains
                 " was encountered."
             call errmgr%report_error("br_open", trim(errmsg), &
                 FCORE_FILE_IO_ERROR)
+            return
         end if
         call this%set_unit(val)
         call this%set_filename(fname)
         call this%move_to_start()
+
+        ! Open a handle for positional reads.  If this fails, close the unit
+        ! as well so the reader is not left partially open.
+        this%m_handle = open_positional_file_c(fname // c_null_char)
+        if (.not.c_associated(this%m_handle)) then
+            call this%close()
+            call errmgr%report_error("br_open", &
+                "The file could not be opened for positional access.", &
+                FCORE_FILE_IO_ERROR)
+        end if
     end subroutine
 
 ! ------------------------------------------------------------------------------
@@ -1151,5 +1164,1305 @@ contains
         rst = this%read_bytes(n, err)
     end function
 
+! ------------------------------------------------------------------------------
+    !> @brief Closes the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[in] del An optional input, that if set, determines if the file
+    !!  should be deleted once closed.  The default is false such that the
+    !!  file remains.
+    module subroutine br_close(this, del)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        logical, intent(in), optional :: del
+
+        ! Release the positional access handle
+        if (c_associated(this%m_handle)) then
+            call close_positional_file_c(this%m_handle)
+            this%m_handle = c_null_ptr
+        end if
+
+        ! Close the file
+        call this%file_manager%close(del)
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Closes the file, and performs any necessary clean-up operations.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    module subroutine br_clean_up(this)
+        type(binary_reader), intent(inout) :: this
+        call this%close()
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a range of bytes from the file without referencing or
+    !! altering the current position.
+    !!
+    !! @param[in] this The binary_reader object.
+    !! @param[in] pos The file position (one-based) of the first byte to read.
+    !! @param[in] n The number of bytes to read.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_INVALID_INPUT_ERROR: Occurs if @p pos is less than one, or if
+    !!      @p n is negative.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory
+    !!      available.
+    !!
+    !! @result An array containing the results.
+    module function br_read_at(this, pos, n, err) result(rst)
+        ! Arguments
+        class(binary_reader), intent(in) :: this
+        integer(int64), intent(in) :: pos, n
+        class(errors), intent(inout), optional, target :: err
+        integer(int8), allocatable, dimension(:) :: rst
+
+        ! Local Variables
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+        character(len = 256) :: errmsg
+        integer(int32) :: flag
+        integer(int64) :: fsize, nbytes, nread
+        
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Ensure the file is opened for reading
+        if (.not.c_associated(this%m_handle)) then
+            call errmgr%report_error("br_read_at", &
+                "The file is not opened for reading.", &
+                FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Input Checking
+        if (pos < 1 .or. n < 0) then
+            write(errmsg, '(AI0AI0A)') "Invalid range requested.  " // &
+                "Position: ", pos, ", Byte Count: ", n, "."
+            call errmgr%report_error("br_read_at", trim(errmsg), &
+                FCORE_INVALID_INPUT_ERROR)
+            return
+        end if
+
+        ! Clip the range to the end of the file
+        fsize = positional_file_size_c(this%m_handle)
+        if (fsize < 0) then
+            call errmgr%report_error("br_read_at", &
+                "The size of the file could not be determined.", &
+                FCORE_FILE_IO_ERROR)
+            return
+        end if
+        nbytes = max(0_int64, min(n, fsize - pos + 1))
+        allocate(rst(nbytes), stat = flag)
+        if (flag /= 0) then
+            call errmgr%report_error("br_read_at", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+        if (nbytes == 0) return
+
+        ! Perform the read operation
+        nread = read_positional_file_c(this%m_handle, pos - 1, nbytes, rst)
+        if (nread /= nbytes) then
+            write(errmsg, '(AI0AI0A)') "The file could not be read.  " // &
+                "Expected ", nbytes, " bytes, but read ", nread, "."
+            call errmgr%report_error("br_read_at", trim(errmsg), &
+                FCORE_FILE_IO_ERROR)
+            return
+        end if
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads the entire contents of the file into a buffer by splitting
+    !! the file into ranges, and reading the ranges in parallel.
+    !!
+    !! @param[in] this The binary_reader object.
+    !! @param[in] chunk An optional input specifying the size, in bytes, of 
+    !!  each range.  The default is 8 MB.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_INVALID_INPUT_ERROR: Occurs if @p chunk is less than one.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there is insufficient memory
+    !!      available.
+    !!
+    !! @result An array containing the results.
+    module function br_read_all_parallel(this, chunk, err) result(rst)
+        ! Arguments
+        class(binary_reader), intent(in) :: this
+        integer(int64), intent(in), optional :: chunk
+        class(errors), intent(inout), optional, target :: err
+        integer(int8), allocatable, dimension(:) :: rst
+
+        ! Parameters
+        integer(int64), parameter :: DEFAULT_CHUNK_SIZE = 8388608
+
+        ! Local Variables
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+        integer(int32) :: flag
+        integer(int64) :: i, i1, i2, fsize, csize, nchunks, nfailed
+        
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        csize = DEFAULT_CHUNK_SIZE
+        if (present(chunk)) csize = chunk
+
+        ! Ensure the file is opened for reading
+        if (.not.c_associated(this%m_handle)) then
+            call errmgr%report_error("br_read_all_parallel", &
+                "The file is not opened for reading.", &
+                FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Input Checking
+        if (csize < 1) then
+            call errmgr%report_error("br_read_all_parallel", &
+                "The chunk size must be greater than 0.", &
+                FCORE_INVALID_INPUT_ERROR)
+            return
+        end if
+
+        ! Allocate the destination
+        fsize = positional_file_size_c(this%m_handle)
+        if (fsize < 0) then
+            call errmgr%report_error("br_read_all_parallel", &
+                "The size of the file could not be determined.", &
+                FCORE_FILE_IO_ERROR)
+            return
+        end if
+        allocate(rst(fsize), stat = flag)
+        if (flag /= 0) then
+            call errmgr%report_error("br_read_all_parallel", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+
+        ! Read each range directly into its place in the destination
+        nchunks = (fsize + csize - 1) / csize
+        nfailed = 0
+        !$omp parallel do schedule(dynamic) private(i1, i2) &
+        !$omp& reduction(+:nfailed)
+        do i = 1, nchunks
+            i1 = (i - 1) * csize + 1
+            i2 = min(i * csize, fsize)
+            if (read_positional_file_c(this%m_handle, i1 - 1, i2 - i1 + 1, &
+                    rst(i1:i2)) /= i2 - i1 + 1) nfailed = nfailed + 1
+        end do
+        !$omp end parallel do
+
+        if (nfailed > 0) then
+            call errmgr%report_error("br_read_all_parallel", &
+                "The file could not be read.", FCORE_FILE_IO_ERROR)
+            return
+        end if
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a 64-bit floating-point value from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_r64(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        real(real64), intent(out) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_r64", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8, &
+            "br_read_r64", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads an array of 64-bit floating-point values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_r64_array(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        real(real64), intent(out), dimension(:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_r64_array", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_r64_array", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a matrix of 64-bit floating-point values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_r64_matrix(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        real(real64), intent(out), dimension(:,:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_r64_matrix", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_r64_matrix", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a 32-bit floating-point value from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_r32(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        real(real32), intent(out) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_r32", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8, &
+            "br_read_r32", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads an array of 32-bit floating-point values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_r32_array(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        real(real32), intent(out), dimension(:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_r32_array", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_r32_array", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a matrix of 32-bit floating-point values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_r32_matrix(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        real(real32), intent(out), dimension(:,:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_r32_matrix", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_r32_matrix", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a 16-bit integer value from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i16(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int16), intent(out) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i16", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8, &
+            "br_read_i16", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads an array of 16-bit integer values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i16_array(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int16), intent(out), dimension(:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i16_array", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_i16_array", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a matrix of 16-bit integer values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i16_matrix(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int16), intent(out), dimension(:,:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i16_matrix", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_i16_matrix", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a 32-bit integer value from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i32(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int32), intent(out) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i32", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8, &
+            "br_read_i32", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads an array of 32-bit integer values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i32_array(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int32), intent(out), dimension(:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i32_array", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_i32_array", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a matrix of 32-bit integer values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i32_matrix(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int32), intent(out), dimension(:,:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i32_matrix", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_i32_matrix", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a 64-bit integer value from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i64(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int64), intent(out) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i64", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8, &
+            "br_read_i64", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads an array of 64-bit integer values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i64_array(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int64), intent(out), dimension(:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i64_array", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_i64_array", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a matrix of 64-bit integer values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_i64_matrix(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int64), intent(out), dimension(:,:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_i64_matrix", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_i64_matrix", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a 64-bit complex value from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_c64(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        complex(real64), intent(out) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_c64", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8, &
+            "br_read_c64", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads an array of 64-bit complex values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_c64_array(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        complex(real64), intent(out), dimension(:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_c64_array", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_c64_array", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a matrix of 64-bit complex values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_c64_matrix(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        complex(real64), intent(out), dimension(:,:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_c64_matrix", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_c64_matrix", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a 32-bit complex value from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_c32(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        complex(real32), intent(out) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_c32", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8, &
+            "br_read_c32", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads an array of 32-bit complex values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_c32_array(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        complex(real32), intent(out), dimension(:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_c32_array", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_c32_array", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reads a matrix of 32-bit complex values from the file.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[out] x The item to populate.
+    !! @param[in] swap An optional input that, if set to true, reverses the
+    !!  byte order of each value once read.  The default is false.
+    !! @param[in,out] err An optional errors-based object that if provided can 
+    !!  be used to retrieve information relating to any errors encountered 
+    !!  during execution.  If not provided, a default implementation of the 
+    !!  errors class is used internally to provide error handling.  Possible 
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file hasn't been opened.
+    !!  - FCORE_END_OF_FILE_ERROR: Occurs if the end of the file is 
+    !!      encountered before @p x is filled.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be read.
+    module subroutine br_read_c32_matrix(this, x, swap, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        complex(real32), intent(out), dimension(:,:) :: x
+        logical, intent(in), optional :: swap
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        if (.not.this%is_open()) then
+            call errmgr%report_error("br_read_c32_matrix", &
+                "The file is not opened for reading.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Process
+        read(this%get_unit(), pos = this%get_position(), iostat = flag) x
+        call br_complete_read(this, flag, storage_size(x) / 8 * size(x), &
+            "br_read_c32_matrix", errmgr)
+        if (flag /= 0) return
+        if (present(swap)) then
+            if (swap) x = swap_bytes(x)
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Completes a typed read operation by checking the I/O status, 
+    !! and advancing the position indicator past the data read.
+    !!
+    !! Callers should test @p flag, not the state of @p err, to determine if
+    !! the read succeeded as @p err may carry an error from an earlier call.
+    !!
+    !! @param[in,out] this The binary_reader object.
+    !! @param[in] flag The I/O status returned by the read operation.
+    !! @param[in] nbytes The number of bytes read.
+    !! @param[in] fcn The name of the calling routine.
+    !! @param[in,out] err The errors-based object used to report errors.
+    subroutine br_complete_read(this, flag, nbytes, fcn, err)
+        ! Arguments
+        class(binary_reader), intent(inout) :: this
+        integer(int32), intent(in) :: flag, nbytes
+        character(len = *), intent(in) :: fcn
+        class(errors), intent(inout) :: err
+
+        ! Local Variables
+        character(len = 256) :: errmsg
+
+        ! Process
+        if (flag > 0) then
+            write(errmsg, '(AI0A)') &
+                "The file could not be read.  Error code ", flag, &
+                " was encountered."
+            call err%report_error(fcn, trim(errmsg), FCORE_FILE_IO_ERROR)
+            return
+        else if (flag < 0) then
+            call err%report_error(fcn, &
+                "The end of the file has been encountered.", &
+                FCORE_END_OF_FILE_ERROR)
+            return
+        end if
+        call this%set_position(this%get_position() + nbytes)
+    end subroutine
+
 ! ------------------------------------------------------------------------------
 end submodule
@@ -0,0 +1,787 @@
+! file_io_delimited.f90
+
+submodule (file_io) file_io_delimited
+    !$ use omp_lib
+    !> @brief The approximate size, in characters, of each block of text
+    !! formatted prior to being written to file.
+    integer(int32), parameter :: EXPORT_BLOCK_SIZE = 1048576
+    !> @brief An estimate of the number of characters required to represent
+    !! a single value, including the delimiter.
+    integer(int32), parameter :: EXPORT_VALUE_SIZE = 24
+    !> @brief The number of blocks formatted per thread before the formatted
+    !! text is written to file.
+    integer(int32), parameter :: EXPORT_BLOCKS_PER_THREAD = 4
+    !> @brief The size of the buffer used to format individual values.
+    integer(int32), parameter :: VALUE_BUFFER_SIZE = 128
+    !> @brief The initial number of rows a text_block can track before its
+    !! list of row endings must be grown.
+    integer(int32), parameter :: EXPORT_ROW_CAPACITY = 1024
+
+    !> @brief A growable buffer used to format a block of rows of text.
+    !!
+    !! @par Remarks
+    !! The string_builder type is deliberately not used here.  Its to_string
+    !! routine returns a deferred-length string, and some compilers store the
+    !! length of such a result in static memory, which is not safe when
+    !! blocks are formatted concurrently.
+    !!
+    !! Rows are stored without a line terminator.  The end of each row is
+    !! tracked instead, so that each row can be written as its own record
+    !! and terminated the same way as any other line written by the
+    !! text_writer.
+    type text_block
+        !> @brief The text buffer.
+        character(len = :), allocatable :: text
+        !> @brief The number of characters in use.
+        integer(int32) :: length = 0
+        !> @brief The index of the last character of each row.
+        integer(int32), allocatable, dimension(:) :: ends
+        !> @brief The number of rows in the block.
+        integer(int32) :: rows = 0
+        !> @brief The code of the first error encountered while formatting
+        !! the block, or 0 if no error has occurred.
+        integer(int32) :: status = 0
+    end type
+contains
+! ------------------------------------------------------------------------------
+    !> @brief Writes a matrix to the file as delimited text.
+    !!
+    !! @param[in] this The text_writer object.
+    !! @param[in] x The matrix to write.
+    !! @param[in] delim An optional input specifying the delimiter.  The
+    !!  default is a comma.
+    !! @param[in] fmt An optional Fortran format string used to format each
+    !!  value.  If not supplied, the shortest representation that reads back
+    !!  to the exact same value is used.
+    !! @param[in,out] err An optional errors-based object that if provided can
+    !!  be used to retrieve information relating to any errors encountered
+    !!  during execution.  If not provided, a default implementation of the
+    !!  errors class is used internally to provide error handling.  Possible
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file has not yet been opened.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be written, or if
+    !!      a value could not be formatted using @p fmt.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there isn't sufficient memory
+    !!      available.
+    module subroutine tw_write_delim_r64(this, x, delim, fmt, err)
+        ! Arguments
+        class(text_writer), intent(in) :: this
+        real(real64), intent(in), dimension(:,:) :: x
+        character(len = *), intent(in), optional :: delim, fmt
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: i, k, nblocks, nbatch, first, last, rows, flag
+        type(text_block), allocatable, dimension(:) :: blocks
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Error Checking
+        if (.not.this%is_open()) then
+            call errmgr%report_error("tw_write_delim_r64", &
+                "The file is not opened.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Determine the block structure
+        call delimited_block_plan(size(x, 1), size(x, 2), rows, nblocks, nbatch)
+        allocate(blocks(nbatch), stat = flag)
+        if (flag /= 0) then
+            call errmgr%report_error("tw_write_delim_r64", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+
+        ! Format a batch of blocks in parallel, and then write the batch
+        do first = 1, nblocks, nbatch
+            last = min(first + nbatch - 1, nblocks)
+            !$omp parallel do private(i) schedule(dynamic)
+            do k = first, last
+                i = (k - 1) * rows + 1
+                call format_r64_rows(x, i, min(i + rows - 1, size(x, 1)), delim, &
+                    fmt, blocks(k - first + 1))
+            end do
+            !$omp end parallel do
+            call report_block_errors(blocks(1:last - first + 1), &
+                "tw_write_delim_r64", errmgr)
+            if (errmgr%has_error_occurred()) return
+            call write_blocks(this, blocks(1:last - first + 1), &
+                "tw_write_delim_r64", errmgr)
+            if (errmgr%has_error_occurred()) return
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Writes a matrix to the file as delimited text.
+    !!
+    !! @param[in] this The text_writer object.
+    !! @param[in] x The matrix to write.
+    !! @param[in] delim An optional input specifying the delimiter.  The
+    !!  default is a comma.
+    !! @param[in] fmt An optional Fortran format string used to format each
+    !!  value.  If not supplied, the values are written without padding.
+    !! @param[in,out] err An optional errors-based object that if provided can
+    !!  be used to retrieve information relating to any errors encountered
+    !!  during execution.  If not provided, a default implementation of the
+    !!  errors class is used internally to provide error handling.  Possible
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file has not yet been opened.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be written, or if
+    !!      a value could not be formatted using @p fmt.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there isn't sufficient memory
+    !!      available.
+    module subroutine tw_write_delim_i64(this, x, delim, fmt, err)
+        ! Arguments
+        class(text_writer), intent(in) :: this
+        integer(int64), intent(in), dimension(:,:) :: x
+        character(len = *), intent(in), optional :: delim, fmt
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: i, k, nblocks, nbatch, first, last, rows, flag
+        type(text_block), allocatable, dimension(:) :: blocks
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Error Checking
+        if (.not.this%is_open()) then
+            call errmgr%report_error("tw_write_delim_i64", &
+                "The file is not opened.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Determine the block structure
+        call delimited_block_plan(size(x, 1), size(x, 2), rows, nblocks, nbatch)
+        allocate(blocks(nbatch), stat = flag)
+        if (flag /= 0) then
+            call errmgr%report_error("tw_write_delim_i64", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+
+        ! Format a batch of blocks in parallel, and then write the batch
+        do first = 1, nblocks, nbatch
+            last = min(first + nbatch - 1, nblocks)
+            !$omp parallel do private(i) schedule(dynamic)
+            do k = first, last
+                i = (k - 1) * rows + 1
+                call format_i64_rows(x, i, min(i + rows - 1, size(x, 1)), delim, &
+                    fmt, blocks(k - first + 1))
+            end do
+            !$omp end parallel do
+            call report_block_errors(blocks(1:last - first + 1), &
+                "tw_write_delim_i64", errmgr)
+            if (errmgr%has_error_occurred()) return
+            call write_blocks(this, blocks(1:last - first + 1), &
+                "tw_write_delim_i64", errmgr)
+            if (errmgr%has_error_occurred()) return
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Writes a data_table to the file as delimited text.
+    !!
+    !! @param[in] this The text_writer object.
+    !! @param[in] x The data_table to write.
+    !! @param[in] delim An optional input specifying the delimiter.  The
+    !!  default is a comma.
+    !! @param[in] fmt An optional Fortran format string used to format each
+    !!  floating-point value.  If not supplied, the shortest representation
+    !!  that reads back to the exact same value is used.
+    !! @param[in] header An optional input that determines if the column
+    !!  headers should be written as the first row.  The default is true.
+    !! @param[in,out] err An optional errors-based object that if provided can
+    !!  be used to retrieve information relating to any errors encountered
+    !!  during execution.  If not provided, a default implementation of the
+    !!  errors class is used internally to provide error handling.  Possible
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_UNOPENED_ERROR: Occurs if the file has not yet been opened.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be written, or if
+    !!      a value could not be formatted using @p fmt.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there isn't sufficient memory
+    !!      available.
+    module subroutine tw_write_delim_table(this, x, delim, fmt, header, err)
+        ! Arguments
+        class(text_writer), intent(in) :: this
+        class(data_table), intent(in) :: x
+        character(len = *), intent(in), optional :: delim, fmt
+        logical, intent(in), optional :: header
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        logical :: writeHeader
+        integer(int32) :: i, j, k, m, n, nblocks, nbatch, first, last, rows, &
+            flag
+        type(text_block), allocatable, dimension(:) :: blocks
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        writeHeader = .true.
+        if (present(header)) writeHeader = header
+        m = x%get_row_count()
+        n = x%get_column_count()
+
+        ! Error Checking
+        if (.not.this%is_open()) then
+            call errmgr%report_error("tw_write_delim_table", &
+                "The file is not opened.", FCORE_UNOPENED_ERROR)
+            return
+        end if
+
+        ! Determine the block structure
+        call delimited_block_plan(m, n, rows, nblocks, nbatch)
+        allocate(blocks(nbatch), stat = flag)
+        if (flag /= 0) then
+            call errmgr%report_error("tw_write_delim_table", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+
+        ! Write the headers
+        if (writeHeader .and. n > 0) then
+            do j = 1, n
+                if (j > 1) call append_delimiter(blocks(1), delim)
+                call append_text(blocks(1), x%get_header(j), delim)
+            end do
+            call block_end_row(blocks(1))
+            call report_block_errors(blocks(1:1), "tw_write_delim_table", &
+                errmgr)
+            if (errmgr%has_error_occurred()) return
+            call write_blocks(this, blocks(1:1), "tw_write_delim_table", &
+                errmgr)
+            if (errmgr%has_error_occurred()) return
+        end if
+
+        ! Format a batch of blocks in parallel, and then write the batch
+        do first = 1, nblocks, nbatch
+            last = min(first + nbatch - 1, nblocks)
+            !$omp parallel do private(i) schedule(dynamic)
+            do k = first, last
+                i = (k - 1) * rows + 1
+                call format_table_rows(x, i, min(i + rows - 1, m), delim, &
+                    fmt, blocks(k - first + 1))
+            end do
+            !$omp end parallel do
+            call report_block_errors(blocks(1:last - first + 1), &
+                "tw_write_delim_table", errmgr)
+            if (errmgr%has_error_occurred()) return
+            call write_blocks(this, blocks(1:last - first + 1), &
+                "tw_write_delim_table", errmgr)
+            if (errmgr%has_error_occurred()) return
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Determines how the rows of a matrix are to be split into blocks
+    !! for formatting.
+    !!
+    !! @param[in] m The number of rows.
+    !! @param[in] n The number of columns.
+    !! @param[out] rows The number of rows in each block.
+    !! @param[out] nblocks The total number of blocks.
+    !! @param[out] nbatch The number of blocks to format before writing.
+    module subroutine delimited_block_plan(m, n, rows, nblocks, nbatch)
+        ! Arguments
+        integer(int32), intent(in) :: m, n
+        integer(int32), intent(out) :: rows, nblocks, nbatch
+
+        ! Local Variables
+        integer(int32) :: nthreads
+
+        ! Process
+        nthreads = 1
+        !$ nthreads = omp_get_max_threads()
+        rows = max(1, EXPORT_BLOCK_SIZE / (EXPORT_VALUE_SIZE * max(1, n)))
+        nblocks = (m + rows - 1) / rows
+        nbatch = max(1, min(nblocks, EXPORT_BLOCKS_PER_THREAD * nthreads))
+    end subroutine
+
+! ******************************************************************************
+! PRIVATE ROUTINES
+! ------------------------------------------------------------------------------
+    !> @brief Writes each block of text to file, one record per row.
+    !!
+    !! @param[in] this The text_writer object.
+    !! @param[in] blocks The blocks of text to write.
+    !! @param[in] fcn The name of the calling routine.
+    !! @param[in,out] err The errors-based object used to report errors.
+    subroutine write_blocks(this, blocks, fcn, err)
+        ! Arguments
+        class(text_writer), intent(in) :: this
+        type(text_block), intent(in), dimension(:) :: blocks
+        character(len = *), intent(in) :: fcn
+        class(errors), intent(inout) :: err
+
+        ! Local Variables
+        integer(int32) :: i, j, start, flag
+        character(len = 256) :: errmsg
+
+        ! Process
+        do i = 1, size(blocks)
+            start = 1
+            do j = 1, blocks(i)%rows
+                write(this%get_unit(), '(A)', iostat = flag) &
+                    blocks(i)%text(start:blocks(i)%ends(j))
+                if (flag /= 0) then
+                    write(errmsg, "(AI0A)") &
+                        "The file could not be written.  Error code ", &
+                        flag, " was encountered."
+                    call err%report_error(fcn, trim(errmsg), &
+                        FCORE_FILE_IO_ERROR)
+                    return
+                end if
+                start = blocks(i)%ends(j) + 1
+            end do
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Formats a range of rows of a matrix as delimited text.
+    !!
+    !! @param[in] x The matrix.
+    !! @param[in] i1 The first row to format.
+    !! @param[in] i2 The last row to format.
+    !! @param[in] delim The optional delimiter.
+    !! @param[in] fmt The optional format string.
+    !! @param[in,out] blk The text_block to receive the formatted rows.  Any
+    !!  existing contents are discarded.  The status of @p blk is set if an
+    !!  error occurs.
+    subroutine format_r64_rows(x, i1, i2, delim, fmt, blk)
+        ! Arguments
+        real(real64), intent(in), dimension(:,:) :: x
+        integer(int32), intent(in) :: i1, i2
+        character(len = *), intent(in), optional :: delim, fmt
+        type(text_block), intent(inout) :: blk
+
+        ! Local Variables
+        integer(int32) :: i, j
+
+        ! Process
+        call block_reset(blk)
+        do i = i1, i2
+            do j = 1, size(x, 2)
+                if (j > 1) call append_delimiter(blk, delim)
+                call append_r64(blk, x(i,j), fmt)
+            end do
+            call block_end_row(blk)
+            if (blk%status /= 0) exit
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Formats a range of rows of a matrix as delimited text.
+    !!
+    !! @param[in] x The matrix.
+    !! @param[in] i1 The first row to format.
+    !! @param[in] i2 The last row to format.
+    !! @param[in] delim The optional delimiter.
+    !! @param[in] fmt The optional format string.
+    !! @param[in,out] blk The text_block to receive the formatted rows.  Any
+    !!  existing contents are discarded.  The status of @p blk is set if an
+    !!  error occurs.
+    subroutine format_i64_rows(x, i1, i2, delim, fmt, blk)
+        ! Arguments
+        integer(int64), intent(in), dimension(:,:) :: x
+        integer(int32), intent(in) :: i1, i2
+        character(len = *), intent(in), optional :: delim, fmt
+        type(text_block), intent(inout) :: blk
+
+        ! Local Variables
+        integer(int32) :: i, j
+
+        ! Process
+        call block_reset(blk)
+        do i = i1, i2
+            do j = 1, size(x, 2)
+                if (j > 1) call append_delimiter(blk, delim)
+                call append_i64(blk, x(i,j), fmt)
+            end do
+            call block_end_row(blk)
+            if (blk%status /= 0) exit
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Formats a range of rows of a data_table as delimited text.
+    !!
+    !! @param[in] x The data_table.
+    !! @param[in] i1 The first row to format.
+    !! @param[in] i2 The last row to format.
+    !! @param[in] delim The optional delimiter.
+    !! @param[in] fmt The optional format string.
+    !! @param[in,out] blk The text_block to receive the formatted rows.  Any
+    !!  existing contents are discarded.  The status of @p blk is set if an
+    !!  error occurs.
+    subroutine format_table_rows(x, i1, i2, delim, fmt, blk)
+        ! Arguments
+        class(data_table), intent(in) :: x
+        integer(int32), intent(in) :: i1, i2
+        character(len = *), intent(in), optional :: delim, fmt
+        type(text_block), intent(inout) :: blk
+
+        ! Local Variables
+        integer(int32) :: i, j
+        class(*), pointer :: item
+
+        ! Process
+        call block_reset(blk)
+        do i = i1, i2
+            do j = 1, x%get_column_count()
+                if (j > 1) call append_delimiter(blk, delim)
+                item => x%get(i, j)
+                if (associated(item)) call append_item(blk, item, delim, fmt)
+            end do
+            call block_end_row(blk)
+            if (blk%status /= 0) exit
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Clears a text_block such that it may be reused.  Any memory
+    !! already allocated by the block is retained.
+    !!
+    !! @param[in,out] blk The text_block object.
+    subroutine block_reset(blk)
+        type(text_block), intent(inout) :: blk
+        blk%length = 0
+        blk%rows = 0
+        blk%status = 0
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Reports the first error encountered while formatting a set of
+    !! blocks.
+    !!
+    !! @param[in] blocks The blocks.
+    !! @param[in] fcn The name of the calling routine.
+    !! @param[in,out] err The errors-based object used to report errors.
+    subroutine report_block_errors(blocks, fcn, err)
+        ! Arguments
+        type(text_block), intent(in), dimension(:) :: blocks
+        character(len = *), intent(in) :: fcn
+        class(errors), intent(inout) :: err
+
+        ! Local Variables
+        integer(int32) :: i
+
+        ! Process
+        do i = 1, size(blocks)
+            select case (blocks(i)%status)
+            case (0)
+                cycle
+            case (FCORE_OUT_OF_MEMORY_ERROR)
+                call err%report_error(fcn, &
+                    "Insufficient memory available.", &
+                    FCORE_OUT_OF_MEMORY_ERROR)
+            case default
+                call err%report_error(fcn, "A value could not be " // &
+                    "formatted using the supplied format string.", &
+                    blocks(i)%status)
+            end select
+            return
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Appends text to a text_block, growing the buffer as necessary.
+    !!
+    !! @param[in,out] blk The text_block object.  If the buffer cannot be
+    !!  grown, the status of @p blk is set to FCORE_OUT_OF_MEMORY_ERROR.
+    !! @param[in] txt The text to append.
+    subroutine block_append(blk, txt)
+        ! Arguments
+        type(text_block), intent(inout) :: blk
+        character(len = *), intent(in) :: txt
+
+        ! Local Variables
+        integer(int32) :: n, flag
+        character(len = :), allocatable :: temp
+
+        ! Quick Return
+        if (blk%status /= 0) return
+
+        ! Process
+        n = len(txt)
+        if (.not.allocated(blk%text)) then
+            allocate(character(len = max(n, EXPORT_BLOCK_SIZE)) :: blk%text, &
+                stat = flag)
+            if (flag /= 0) go to 100
+        else if (len(blk%text) - blk%length < n) then
+            allocate(character(len = max(2 * len(blk%text), &
+                blk%length + n)) :: temp, stat = flag)
+            if (flag /= 0) go to 100
+            temp(1:blk%length) = blk%text(1:blk%length)
+            call move_alloc(temp, blk%text)
+        end if
+        blk%text(blk%length + 1:blk%length + n) = txt
+        blk%length = blk%length + n
+
+        return
+    100 continue
+        blk%status = FCORE_OUT_OF_MEMORY_ERROR
+        return
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Marks the end of the current row of a text_block.
+    !!
+    !! @param[in,out] blk The text_block object.  If the list of row endings
+    !!  cannot be grown, the status of @p blk is set to 
+    !!  FCORE_OUT_OF_MEMORY_ERROR.
+    subroutine block_end_row(blk)
+        ! Arguments
+        type(text_block), intent(inout) :: blk
+
+        ! Local Variables
+        integer(int32) :: flag
+        integer(int32), allocatable, dimension(:) :: temp
+
+        ! Quick Return
+        if (blk%status /= 0) return
+
+        ! Process
+        if (.not.allocated(blk%ends)) then
+            allocate(blk%ends(EXPORT_ROW_CAPACITY), stat = flag)
+            if (flag /= 0) go to 100
+        else if (blk%rows == size(blk%ends)) then
+            allocate(temp(2 * size(blk%ends)), stat = flag)
+            if (flag /= 0) go to 100
+            temp(1:blk%rows) = blk%ends(1:blk%rows)
+            call move_alloc(temp, blk%ends)
+        end if
+        blk%rows = blk%rows + 1
+        blk%ends(blk%rows) = blk%length
+
+        return
+    100 continue
+        blk%status = FCORE_OUT_OF_MEMORY_ERROR
+        return
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Appends the delimiter to a text_block.
+    !!
+    !! @param[in,out] blk The text_block object.
+    !! @param[in] delim The optional delimiter.  If not supplied, a comma is
+    !!  used.
+    subroutine append_delimiter(blk, delim)
+        type(text_block), intent(inout) :: blk
+        character(len = *), intent(in), optional :: delim
+        if (present(delim)) then
+            call block_append(blk, delim)
+        else
+            call block_append(blk, ",")
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Appends a formatted 64-bit floating-point value to a
+    !! text_block.
+    !!
+    !! @param[in,out] blk The text_block object.
+    !! @param[in] x The value.
+    !! @param[in] fmt The optional format string.  If the value cannot be
+    !!  formatted, the status of @p blk is set to FCORE_FILE_IO_ERROR.
+    subroutine append_r64(blk, x, fmt)
+        ! Arguments
+        type(text_block), intent(inout) :: blk
+        real(real64), intent(in) :: x
+        character(len = *), intent(in), optional :: fmt
+
+        ! Local Variables
+        integer(int32) :: n, flag
+        character(len = VALUE_BUFFER_SIZE) :: buffer
+
+        ! Process
+        if (present(fmt)) then
+            write(buffer, fmt, iostat = flag) x
+            if (flag /= 0) then
+                if (blk%status == 0) blk%status = FCORE_FILE_IO_ERROR
+                return
+            end if
+            call block_append(blk, trim(adjustl(buffer)))
+        else
+            n = format_real64_c(x, buffer)
+            call block_append(blk, buffer(1:n))
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Appends a formatted 32-bit floating-point value to a
+    !! text_block.
+    !!
+    !! @param[in,out] blk The text_block object.
+    !! @param[in] x The value.
+    !! @param[in] fmt The optional format string.  If the value cannot be
+    !!  formatted, the status of @p blk is set to FCORE_FILE_IO_ERROR.
+    subroutine append_r32(blk, x, fmt)
+        ! Arguments
+        type(text_block), intent(inout) :: blk
+        real(real32), intent(in) :: x
+        character(len = *), intent(in), optional :: fmt
+
+        ! Local Variables
+        integer(int32) :: n, flag
+        character(len = VALUE_BUFFER_SIZE) :: buffer
+
+        ! Process
+        if (present(fmt)) then
+            write(buffer, fmt, iostat = flag) x
+            if (flag /= 0) then
+                if (blk%status == 0) blk%status = FCORE_FILE_IO_ERROR
+                return
+            end if
+            call block_append(blk, trim(adjustl(buffer)))
+        else
+            n = format_real32_c(x, buffer)
+            call block_append(blk, buffer(1:n))
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Appends a formatted 64-bit integer value to a text_block.
+    !!
+    !! @param[in,out] blk The text_block object.
+    !! @param[in] x The value.
+    !! @param[in] fmt The optional format string.  If the value cannot be
+    !!  formatted, the status of @p blk is set to FCORE_FILE_IO_ERROR.
+    subroutine append_i64(blk, x, fmt)
+        ! Arguments
+        type(text_block), intent(inout) :: blk
+        integer(int64), intent(in) :: x
+        character(len = *), intent(in), optional :: fmt
+
+        ! Local Variables
+        integer(int32) :: n, flag
+        character(len = VALUE_BUFFER_SIZE) :: buffer
+
+        ! Process
+        if (present(fmt)) then
+            write(buffer, fmt, iostat = flag) x
+            if (flag /= 0) then
+                if (blk%status == 0) blk%status = FCORE_FILE_IO_ERROR
+                return
+            end if
+            call block_append(blk, trim(adjustl(buffer)))
+        else
+            n = format_int64_c(int(x, c_long_long), buffer)
+            call block_append(blk, buffer(1:n))
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Appends text to a text_block, enclosing the text in
+    !! quotation marks if it contains the delimiter, a quotation mark, or a
+    !! line break.
+    !!
+    !! @param[in,out] blk The text_block object.
+    !! @param[in] txt The text.
+    !! @param[in] delim The optional delimiter.
+    subroutine append_text(blk, txt, delim)
+        ! Arguments
+        type(text_block), intent(inout) :: blk
+        character(len = *), intent(in) :: txt
+        character(len = *), intent(in), optional :: delim
+
+        ! Local Variables
+        logical :: quote
+        integer(int32) :: i, j
+
+        ! Determine if quotes are necessary
+        quote = scan(txt, '"' // char(13) // new_line('a')) /= 0
+        if (present(delim)) then
+            if (len(delim) > 0) quote = quote .or. index(txt, delim) /= 0
+        else
+            quote = quote .or. index(txt, ",") /= 0
+        end if
+        if (.not.quote) then
+            call block_append(blk, txt)
+            return
+        end if
+
+        ! Enclose in quotes, and double any embedded quotes
+        call block_append(blk, '"')
+        i = 1
+        do
+            j = index(txt(i:), '"')
+            if (j == 0) exit
+            call block_append(blk, txt(i:i + j - 1) // '"')
+            i = i + j
+        end do
+        call block_append(blk, txt(i:) // '"')
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Appends a formatted data_table item to a text_block.
+    !!
+    !! @param[in,out] blk The text_block object.
+    !! @param[in] item The item.  Items of a type that cannot be represented
+    !!  as text are skipped.
+    !! @param[in] delim The optional delimiter.
+    !! @param[in] fmt The optional format string used for floating-point
+    !!  values.
+    subroutine append_item(blk, item, delim, fmt)
+        ! Arguments
+        type(text_block), intent(inout) :: blk
+        class(*), intent(in) :: item
+        character(len = *), intent(in), optional :: delim, fmt
+
+        ! Process
+        select type (item)
+        type is (real(real64))
+            call append_r64(blk, item, fmt)
+        type is (real(real32))
+            call append_r32(blk, item, fmt)
+        type is (integer(int64))
+            call append_i64(blk, item)
+        type is (integer(int32))
+            call append_i64(blk, int(item, int64))
+        type is (integer(int16))
+            call append_i64(blk, int(item, int64))
+        type is (integer(int8))
+            call append_i64(blk, int(item, int64))
+        type is (complex(real64))
+            call append_r64(blk, real(item), fmt)
+            if (aimag(item) >= 0.0d0) call block_append(blk, "+")
+            call append_r64(blk, aimag(item), fmt)
+            call block_append(blk, "i")
+        type is (complex(real32))
+            call append_r32(blk, real(item), fmt)
+            if (aimag(item) >= 0.0) call block_append(blk, "+")
+            call append_r32(blk, aimag(item), fmt)
+            call block_append(blk, "i")
+        type is (logical)
+            if (item) then
+                call block_append(blk, "true")
+            else
+                call block_append(blk, "false")
+            end if
+        type is (character(len = *))
+            call append_text(blk, item, delim)
+        class is (string)
+            call append_text(blk, item%str, delim)
+        end select
+    end subroutine
+
+! ------------------------------------------------------------------------------
+end submodule
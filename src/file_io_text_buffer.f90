@@ -0,0 +1,420 @@
+! file_io_text_buffer.f90
+
+submodule (file_io) file_io_text_buffer
+    !> @brief The size, in characters, of each block of text scanned for line
+    !! termination characters when building the line index.
+    integer(int64), parameter :: INDEX_BLOCK_SIZE = 1048576_int64
+contains
+! ------------------------------------------------------------------------------
+    !> @brief Reads the entire contents of an ASCII text file into the buffer,
+    !! and indexes the start of each line.
+    !!
+    !! @param[in,out] this The text_buffer object.
+    !! @param[in] fname The name of the file to read.
+    !! @param[in,out] err An optional errors-based object that if provided can
+    !!  be used to retrieve information relating to any errors encountered
+    !!  during execution.  If not provided, a default implementation of the
+    !!  errors class is used internally to provide error handling.  Possible
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_FILE_IO_ERROR: Occurs if the file could not be opened or read.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there isn't sufficient memory
+    !!      available.
+    module subroutine tb_load(this, fname, err)
+        ! Arguments
+        class(text_buffer), intent(inout) :: this
+        character(len = *), intent(in) :: fname
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        integer(int64) :: fsize
+        type(text_reader) :: file
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+        character(len = 256) :: errmsg
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Clear any existing contents
+        if (allocated(this%m_contents)) deallocate(this%m_contents)
+        if (allocated(this%m_lines)) deallocate(this%m_lines)
+        this%m_count = 0
+
+        ! Open the file
+        call file%open(fname, errmgr)
+        if (errmgr%has_error_occurred()) return
+
+        ! Determine the file size, and read the file directly into the buffer
+        inquire(file = fname, size = fsize)
+        if (fsize < 0) fsize = 0
+        allocate(character(len = fsize) :: this%m_contents, stat = flag)
+        if (flag /= 0) then
+            call file%close()
+            call errmgr%report_error("tb_load", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+        if (fsize > 0) then
+            read(unit = file%get_unit(), pos = 1, iostat = flag) this%m_contents
+            if (flag > 0) then
+                call file%close()
+                write(errmsg, "(AI0A)") &
+                    "The file could not be read.  Error code ", flag, &
+                    " was encountered."
+                call errmgr%report_error("tb_load", trim(errmsg), &
+                    FCORE_FILE_IO_ERROR)
+                return
+            end if
+        end if
+        call file%close()
+
+        ! Index the lines
+        call tb_build_index(this, errmgr)
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Copies the supplied text into the buffer, and indexes the start
+    !! of each line.
+    !!
+    !! @param[in,out] this The text_buffer object.
+    !! @param[in] txt The text.
+    !! @param[in,out] err An optional errors-based object that if provided can
+    !!  be used to retrieve information relating to any errors encountered
+    !!  during execution.  If not provided, a default implementation of the
+    !!  errors class is used internally to provide error handling.  Possible
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_OUT_OF_MEMORY_ERROR: Occurs if there isn't sufficient memory
+    !!      available.
+    module subroutine tb_set_text(this, txt, err)
+        ! Arguments
+        class(text_buffer), intent(inout) :: this
+        character(len = *), intent(in) :: txt
+        class(errors), intent(inout), optional, target :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Clear any existing contents
+        if (allocated(this%m_contents)) deallocate(this%m_contents)
+        if (allocated(this%m_lines)) deallocate(this%m_lines)
+        this%m_count = 0
+
+        ! Store a copy of the text
+        allocate(character(len = len(txt)) :: this%m_contents, stat = flag)
+        if (flag /= 0) then
+            call errmgr%report_error("tb_set_text", &
+                "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+            return
+        end if
+        this%m_contents = txt
+
+        ! Index the lines
+        call tb_build_index(this, errmgr)
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Gets the number of lines in the buffer.
+    !!
+    !! @param[in] this The text_buffer object.
+    !! @return The number of lines.
+    pure module function tb_get_count(this) result(rst)
+        class(text_buffer), intent(in) :: this
+        integer(int64) :: rst
+        rst = this%m_count
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Gets the length of the requested line, not including any line
+    !! termination characters.
+    !!
+    !! @param[in] this The text_buffer object.
+    !! @param[in] i The one-based index of the line.
+    !! @return The length of the line.  If @p i is out of range, zero is
+    !!  returned.
+    pure module function tb_get_line_length(this, i) result(rst)
+        ! Arguments
+        class(text_buffer), intent(in) :: this
+        integer(int64), intent(in) :: i
+        integer(int64) :: rst
+
+        ! Local Variables
+        integer(int64) :: first, last
+
+        ! Process
+        rst = 0
+        if (i < 1 .or. i > this%m_count) return
+        call tb_line_bounds(this, i, first, last)
+        rst = last - first + 1
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Gets a copy of the requested line.
+    !!
+    !! @param[in] this The text_buffer object.
+    !! @param[in] i The one-based index of the line.
+    !! @param[in,out] err An optional errors-based object that if provided can
+    !!  be used to retrieve information relating to any errors encountered
+    !!  during execution.  If not provided, a default implementation of the
+    !!  errors class is used internally to provide error handling.  Possible
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p i is outside the bounds
+    !!      of the buffer.
+    !!
+    !! @return The line, without any line termination characters.
+    module function tb_get_line(this, i, err) result(rst)
+        ! Arguments
+        class(text_buffer), intent(in) :: this
+        integer(int64), intent(in) :: i
+        class(errors), intent(inout), optional, target :: err
+        character(len = :), allocatable :: rst
+
+        ! Local Variables
+        integer(int64) :: first, last
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+
+        ! Input Check
+        if (i < 1 .or. i > this%m_count) then
+            call errmgr%report_error("tb_get_line", &
+                "The line index is outside the bounds of the buffer.", &
+                FCORE_INDEX_OUT_OF_RANGE_ERROR)
+            return
+        end if
+
+        ! Process
+        call tb_line_bounds(this, i, first, last)
+        rst = this%m_contents(first:last)
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Gets a pointer to the requested line as it is stored within the
+    !! buffer.  No copy is made.
+    !!
+    !! @param[in] this The text_buffer object.
+    !! @param[in] i The one-based index of the line.
+    !! @param[in,out] err An optional errors-based object that if provided can
+    !!  be used to retrieve information relating to any errors encountered
+    !!  during execution.  If not provided, a default implementation of the
+    !!  errors class is used internally to provide error handling.  Possible
+    !!  errors and warning messages that may be encountered are as follows.
+    !!  - FCORE_INDEX_OUT_OF_RANGE_ERROR: Occurs if @p i is outside the bounds
+    !!      of the buffer.
+    !!
+    !! @return A pointer to the line, without any line termination characters.
+    !!  If @p i is out of range, a null pointer is returned.
+    module function tb_get_line_view(this, i, err) result(rst)
+        ! Arguments
+        class(text_buffer), intent(in), target :: this
+        integer(int64), intent(in) :: i
+        class(errors), intent(inout), optional, target :: err
+        character(len = :), pointer :: rst
+
+        ! Local Variables
+        integer(int64) :: first, last
+        class(errors), pointer :: errmgr
+        type(errors), target :: deferr
+
+        ! Initialization
+        if (present(err)) then
+            errmgr => err
+        else
+            errmgr => deferr
+        end if
+        nullify(rst)
+
+        ! Input Check
+        if (i < 1 .or. i > this%m_count) then
+            call errmgr%report_error("tb_get_line_view", &
+                "The line index is outside the bounds of the buffer.", &
+                FCORE_INDEX_OUT_OF_RANGE_ERROR)
+            return
+        end if
+
+        ! Process
+        call tb_line_bounds(this, i, first, last)
+        rst => this%m_contents(first:last)
+    end function
+
+! ******************************************************************************
+! PRIVATE ROUTINES
+! ------------------------------------------------------------------------------
+    !> @brief Determines the extent of a line within the buffer, excluding any
+    !! line termination characters.
+    !!
+    !! @param[in] this The text_buffer object.
+    !! @param[in] i The one-based index of the line.  This value is assumed to
+    !!  be in range.
+    !! @param[out] first The index of the first character in the line.
+    !! @param[out] last The index of the last character in the line.  If the
+    !!  line is empty, this value is first - 1.
+    pure subroutine tb_line_bounds(this, i, first, last)
+        ! Arguments
+        class(text_buffer), intent(in) :: this
+        integer(int64), intent(in) :: i
+        integer(int64), intent(out) :: first, last
+
+        ! Process
+        first = this%m_lines(i)
+        last = this%m_lines(i + 1) - 1
+        if (last >= first) then
+            if (this%m_contents(last:last) == new_line('a')) last = last - 1
+        end if
+        if (last >= first) then
+            if (this%m_contents(last:last) == char(13)) last = last - 1
+        end if
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Builds the line index for the current buffer contents.
+    !!
+    !! @param[in,out] this The text_buffer object.
+    !! @param[in,out] err The errors-based object used to report errors.
+    !!
+    !! @par Remarks
+    !! The buffer is split into fixed-size blocks.  The new line characters in
+    !! each block are first counted, and then the line start locations are
+    !! written directly into their final location in the index.  For buffers
+    !! spanning multiple blocks, both operations are performed in parallel.
+    subroutine tb_build_index(this, err)
+        ! Arguments
+        class(text_buffer), intent(inout) :: this
+        class(errors), intent(inout) :: err
+
+        ! Local Variables
+        integer(int32) :: flag
+        integer(int64) :: i, n, nblocks, nlines, i1, i2
+        integer(int64), allocatable, dimension(:) :: counts, offsets
+
+        ! Initialization
+        n = len(this%m_contents, int64)
+        nblocks = max(1_int64, (n + INDEX_BLOCK_SIZE - 1) / INDEX_BLOCK_SIZE)
+        allocate(counts(nblocks), offsets(nblocks), stat = flag)
+        if (flag /= 0) go to 100
+
+        ! Count the new line characters in each block
+        !$omp parallel do if(nblocks > 1) private(i1, i2) schedule(static)
+        do i = 1, nblocks
+            i1 = (i - 1) * INDEX_BLOCK_SIZE + 1
+            i2 = min(i * INDEX_BLOCK_SIZE, n)
+            counts(i) = count_new_lines(this%m_contents(i1:i2))
+        end do
+        !$omp end parallel do
+
+        ! Determine where each block's entries begin within the index
+        offsets(1) = 1
+        do i = 2, nblocks
+            offsets(i) = offsets(i - 1) + counts(i - 1)
+        end do
+        nlines = offsets(nblocks) + counts(nblocks) - 1
+        if (n > 0) then
+            if (this%m_contents(n:n) /= new_line('a')) nlines = nlines + 1
+        end if
+
+        ! Store the starting location of each line.  The trailing entry
+        ! always points one past the end of the buffer.
+        allocate(this%m_lines(nlines + 1), stat = flag)
+        if (flag /= 0) go to 100
+        this%m_lines(1) = 1
+        this%m_lines(nlines + 1) = n + 1
+        !$omp parallel do if(nblocks > 1) private(i1, i2) schedule(static)
+        do i = 1, nblocks
+            i1 = (i - 1) * INDEX_BLOCK_SIZE + 1
+            i2 = min(i * INDEX_BLOCK_SIZE, n)
+            call store_line_starts(this%m_contents(i1:i2), i1 - 1, &
+                this%m_lines(offsets(i) + 1:offsets(i) + counts(i)))
+        end do
+        !$omp end parallel do
+
+        ! Ignore any empty lines at the end of the file, consistent with
+        ! the text_reader read_lines routine
+        this%m_count = nlines
+        do while (this%m_count > 0)
+            if (this%get_line_length(this%m_count) /= 0) exit
+            this%m_count = this%m_count - 1
+        end do
+
+        ! End
+        return
+
+        ! Memory Error Handling
+    100 continue
+        if (allocated(this%m_lines)) deallocate(this%m_lines)
+        this%m_count = 0
+        call err%report_error("tb_build_index", &
+            "Insufficient memory available.", FCORE_OUT_OF_MEMORY_ERROR)
+        return
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    !> @brief Counts the number of new line characters in a string.
+    !!
+    !! @param[in] txt The string to search.
+    !! @return The number of new line characters found.
+    pure function count_new_lines(txt) result(rst)
+        ! Arguments
+        character(len = *), intent(in) :: txt
+        integer(int64) :: rst
+
+        ! Local Variables
+        integer(int64) :: i, j
+
+        ! Process
+        rst = 0
+        i = 1
+        do
+            j = index(txt(i:), new_line('a'), kind = int64)
+            if (j == 0) exit
+            rst = rst + 1
+            i = i + j
+        end do
+    end function
+
+! ------------------------------------------------------------------------------
+    !> @brief Stores the location of the character following each new line
+    !! character in a string.
+    !!
+    !! @param[in] txt The string to search.
+    !! @param[in] offset An offset to add to each location.
+    !! @param[out] starts The array to populate.  This array must be sized to
+    !!  match the number of new line characters in @p txt.
+    pure subroutine store_line_starts(txt, offset, starts)
+        ! Arguments
+        character(len = *), intent(in) :: txt
+        integer(int64), intent(in) :: offset
+        integer(int64), intent(out), dimension(:) :: starts
+
+        ! Local Variables
+        integer(int64) :: i, j, k
+
+        ! Process
+        i = 1
+        do k = 1, size(starts, kind = int64)
+            j = index(txt(i:), new_line('a'), kind = int64)
+            i = i + j
+            starts(k) = offset + i
+        end do
+    end subroutine
+
+! ------------------------------------------------------------------------------
+end submodule
@@ -0,0 +1,80 @@
+// number_formatting.cpp
+
+#include "number_formatting.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Floating-point support for std::to_chars is not available in all standard
+// libraries.  Where it is missing, fall back to the shortest of the 15, 16, 
+// or 17 significant digit representations that reads back exactly.
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define HAS_FLOATING_POINT_TO_CHARS
+#endif
+
+#ifndef HAS_FLOATING_POINT_TO_CHARS
+template <typename T>
+static int format_shortest(T x, int minDigits, int maxDigits, char *buffer)
+{
+    char temp[NUMBER_FORMAT_BUFFER_SIZE + 8];
+    int n = 0;
+    for (int p = minDigits; p <= maxDigits; ++p)
+    {
+        n = snprintf(temp, sizeof(temp), "%.*g", p, (double)x);
+        if ((T)strtod(temp, NULL) == x) break;
+    }
+    if (n > NUMBER_FORMAT_BUFFER_SIZE) n = NUMBER_FORMAT_BUFFER_SIZE;
+    memcpy(buffer, temp, n);
+    return n;
+}
+#endif
+
+/* ************************************************************************** */
+/*                               FORMAT_REAL64                                */
+/* ************************************************************************** */
+int format_real64_c(double x, char *buffer)
+{
+#ifdef HAS_FLOATING_POINT_TO_CHARS
+    std::to_chars_result rst = std::to_chars(buffer, 
+        buffer + NUMBER_FORMAT_BUFFER_SIZE, x);
+    return (int)(rst.ptr - buffer);
+#else
+    return format_shortest(x, 15, 17, buffer);
+#endif
+}
+
+/* ************************************************************************** */
+/*                               FORMAT_REAL32                                */
+/* ************************************************************************** */
+int format_real32_c(float x, char *buffer)
+{
+#ifdef HAS_FLOATING_POINT_TO_CHARS
+    std::to_chars_result rst = std::to_chars(buffer, 
+        buffer + NUMBER_FORMAT_BUFFER_SIZE, x);
+    return (int)(rst.ptr - buffer);
+#else
+    return format_shortest(x, 6, 9, buffer);
+#endif
+}
+
+/* ************************************************************************** */
+/*                               FORMAT_INT64                                 */
+/* ************************************************************************** */
+int format_int64_c(long long x, char *buffer)
+{
+#ifdef HAS_FLOATING_POINT_TO_CHARS
+    std::to_chars_result rst = std::to_chars(buffer, 
+        buffer + NUMBER_FORMAT_BUFFER_SIZE, x);
+    return (int)(rst.ptr - buffer);
+#else
+    char temp[NUMBER_FORMAT_BUFFER_SIZE];
+    int n = snprintf(temp, sizeof(temp), "%lld", x);
+    memcpy(buffer, temp, n);
+    return n;
+#endif
+}
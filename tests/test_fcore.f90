@@ -53,18 +53,39 @@ program main
     local = test_text_read_write()
     if (.not.local) overall = .false.
 
+    local = test_text_buffer()
+    if (.not.local) overall = .false.
+
+    local = test_text_write_delimited()
+    if (.not.local) overall = .false.
+
+    local = test_text_write_delimited_blocks()
+    if (.not.local) overall = .false.
+
     local = test_binary_read_write()
     if (.not.local) overall = .false.
 
+    local = test_binary_read_at()
+    if (.not.local) overall = .false.
+
+    local = test_binary_typed_read()
+    if (.not.local) overall = .false.
+
     local = test_dictionary_1()
     if (.not.local) overall = .false.
 
+    local = test_concurrent_dictionary_1()
+    if (.not.local) overall = .false.
+
     local = test_linked_list_1()
     if (.not.local) overall = .false.
 
     local = test_data_table_1()
     if (.not.local) overall = .false.
 
+    local = test_data_table_index()
+    if (.not.local) overall = .false.
+
     ! End
     if (overall) then
         print '(A)', "FCORE: ALL TESTS PASSED"
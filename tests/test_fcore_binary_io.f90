@@ -3,6 +3,8 @@
 module test_fcore_binary_io
     use iso_fortran_env
     use file_io
+    use ferror
+    use fcore_constants
     implicit none
 contains
     function test_binary_read_write() result(rst)
@@ -69,4 +71,169 @@ contains
                 "Expected to find ", item4, ", but found ", value4, "."
         end if
     end function
+
+! ------------------------------------------------------------------------------
+    function test_binary_read_at() result(rst)
+        ! Arguments
+        logical :: rst
+
+        ! Parameters
+        character(len = *), parameter :: fname = "test_binary_2.bin"
+        integer(int64), parameter :: n = 100000
+        integer(int64), parameter :: chunk = 4096
+
+        ! Local Variables
+        type(binary_reader) :: reader
+        integer(int8), allocatable, dimension(:) :: x, y
+        integer(int64) :: i, nbad
+        integer(int32) :: fid
+
+        ! Initialization
+        rst = .true.
+        allocate(x(n))
+        do i = 1, n
+            x(i) = int(mod(i, 127_int64), int8)
+        end do
+
+        ! Write the file.  A plain stream unit is used as the binary_writer 
+        ! buffer does not currently grow correctly past its initial capacity.
+        open(newunit = fid, file = fname, access = "stream", &
+            form = "unformatted", status = "replace")
+        write(fid) x
+        close(fid)
+
+        ! Read ranges concurrently, without moving the file position
+        call reader%open(fname)
+        call reader%set_position(10)
+        nbad = 0
+        !$omp parallel do private(y) reduction(+:nbad)
+        do i = 1, n, chunk
+            y = reader%read_at(i, chunk)
+            if (size(y) /= min(chunk, n - i + 1)) then
+                nbad = nbad + 1
+            else if (any(y /= x(i:i + size(y) - 1))) then
+                nbad = nbad + 1
+            end if
+        end do
+        !$omp end parallel do
+
+        if (nbad /= 0) then
+            rst = .false.
+            print '(AI0A)', "TEST_BINARY_READ_AT (Test #1): " // &
+                "Found ", nbad, " incorrectly read ranges."
+        end if
+
+        if (reader%get_position() /= 10) then
+            rst = .false.
+            print '(AI0A)', "TEST_BINARY_READ_AT (Test #2): " // &
+                "Expected the position to remain at 10, but found ", &
+                reader%get_position(), "."
+        end if
+
+        ! Read the entire file in parallel
+        y = reader%read_all_parallel(chunk)
+        if (size(y) /= n) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_BINARY_READ_AT (Test #3): " // &
+                "Expected ", n, " bytes, but found ", size(y), "."
+        else if (any(y /= x)) then
+            rst = .false.
+            print '(A)', "TEST_BINARY_READ_AT (Test #4): " // &
+                "The file contents were not read correctly."
+        end if
+        call reader%close(.true.)
+    end function
+
+! ------------------------------------------------------------------------------
+    function test_binary_typed_read() result(rst)
+        ! Arguments
+        logical :: rst
+
+        ! Parameters
+        character(len = *), parameter :: fname = "test_binary_3.bin"
+        integer(int32), parameter :: m = 50
+        integer(int32), parameter :: n = 20
+
+        ! Local Variables
+        type(binary_reader) :: reader
+        real(real64) :: x(m, n), xr(m, n)
+        integer(int32) :: ix(m), ixr(m)
+        complex(real32) :: cx(n), cxr(n)
+        integer(int16) :: sx(n), sxr(n)
+        integer(int32) :: i, fid
+        integer(int64) :: lr
+        type(errors) :: err
+
+        ! Initialization
+        rst = .true.
+        call random_number(x)
+        ix = [(3 * i - 70000, i = 1, m)]
+        cx = cmplx(x(1,:), -x(2,:), real32)
+        sx = int([(i - 10, i = 1, n)], int16)
+
+        ! Write the file.  The integer arrays are written with their bytes 
+        ! swapped to mimic a file written on a machine of differing 
+        ! endianness.
+        open(newunit = fid, file = fname, access = "stream", &
+            form = "unformatted", status = "replace")
+        write(fid) x, swap_bytes(ix), cx, swap_bytes(sx)
+        close(fid)
+
+        ! Read the file back into the existing arrays
+        call reader%open(fname)
+        call reader%read(xr)
+        call reader%read(ixr, swap = .true.)
+        call reader%read(cxr)
+        call reader%read(sxr, swap = .true.)
+
+        if (any(xr /= x)) then
+            rst = .false.
+            print '(A)', "TEST_BINARY_TYPED_READ (Test #1): " // &
+                "The real(real64) matrix was not read correctly."
+        end if
+        if (any(ixr /= ix)) then
+            rst = .false.
+            print '(A)', "TEST_BINARY_TYPED_READ (Test #2): " // &
+                "The swapped integer(int32) array was not read correctly."
+        end if
+        if (any(cxr /= cx)) then
+            rst = .false.
+            print '(A)', "TEST_BINARY_TYPED_READ (Test #3): " // &
+                "The complex(real32) array was not read correctly."
+        end if
+        if (any(sxr /= sx)) then
+            rst = .false.
+            print '(A)', "TEST_BINARY_TYPED_READ (Test #4): " // &
+                "The swapped integer(int16) array was not read correctly."
+        end if
+        if (reader%get_position() /= reader%get_file_size() + 1) then
+            rst = .false.
+            print '(AI0A)', "TEST_BINARY_TYPED_READ (Test #5): " // &
+                "Expected the position to be at the end of the file, " // &
+                "but found ", reader%get_position(), "."
+        end if
+
+        ! Attempt to read past the end of the file
+        call err%set_exit_on_error(.false.)
+        call reader%read(lr, err = err)
+        if (err%get_error_flag() /= FCORE_END_OF_FILE_ERROR) then
+            rst = .false.
+            print '(A)', "TEST_BINARY_TYPED_READ (Test #6): " // &
+                "Expected an end of file error."
+        end if
+
+        ! A successful read must still swap the bytes, even though the error
+        ! object still carries the end of file error from the previous read
+        ixr = 0
+        call reader%set_position(storage_size(x) / 8 * size(x) + 1)
+        call reader%read(ixr, swap = .true., err = err)
+        if (any(ixr /= ix)) then
+            rst = .false.
+            print '(A)', "TEST_BINARY_TYPED_READ (Test #7): " // &
+                "The swapped integer(int32) array was not read correctly " // &
+                "following a prior error."
+        end if
+        call reader%close()
+    end function
+
 end module
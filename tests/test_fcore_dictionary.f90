@@ -3,6 +3,7 @@
 module test_fcore_dictionary
     use iso_fortran_env
     use collections
+    !$ use omp_lib
     implicit none
 contains
 ! ------------------------------------------------------------------------------
@@ -110,5 +111,173 @@ contains
         end if
     end function
 
+! ------------------------------------------------------------------------------
+    ! Checks that the item stored under key (optionally added via get_or_add)
+    ! is the expected integer(int64) value.  The pointer is kept local to this
+    ! routine so that it is thread-private without appearing in an OpenMP 
+    ! data-sharing clause.
+    function check_concurrent_item(x, key, expected, add) result(rst)
+        ! Arguments
+        type(concurrent_dictionary), intent(inout) :: x
+        integer(int64), intent(in) :: key, expected
+        logical, intent(in) :: add
+        logical :: rst
+
+        ! Local Variables
+        class(*), pointer :: item
+
+        ! Process
+        rst = .false.
+        if (add) then
+            item => x%get_or_add(key, -1_int64)
+        else
+            item => x%get(key)
+        end if
+        if (.not.associated(item)) return
+        select type (item)
+            type is (integer(int64))
+                rst = item == expected
+        end select
+    end function
+
+! ------------------------------------------------------------------------------
+    ! Builds a thread-local dictionary containing n consecutive keys, starting
+    ! at first, and merges it into x.
+    subroutine merge_concurrent_items(x, first, n)
+        ! Arguments
+        type(concurrent_dictionary), intent(inout) :: x
+        integer(int64), intent(in) :: first
+        integer(int32), intent(in) :: n
+
+        ! Local Variables
+        type(dictionary) :: local
+        integer(int32) :: i
+
+        ! Process
+        do i = 0, n - 1
+            call local%add(first + i, first + i)
+        end do
+        call x%merge(local)
+    end subroutine
+
+! ------------------------------------------------------------------------------
+    function test_concurrent_dictionary_1() result(rst)
+        ! Arguments
+        logical :: rst
+
+        ! Parameters
+        integer(int32), parameter :: n = 20000
+        integer(int32), parameter :: nlocal = 500
+
+        ! Local Variables
+        type(concurrent_dictionary) :: x
+        integer(int32) :: i, nbad, nthreads
+        integer(int64) :: key
+        logical :: temp
+
+        ! Initialization
+        rst = .true.
+        nbad = 0
+        nthreads = 1
+        call x%initialize(8)
+
+        ! Add the items from multiple threads
+        !$omp parallel do private(key)
+        do i = 1, n
+            key = int(i, int64)
+            call x%add(key, 2 * key)
+        end do
+        !$omp end parallel do
+
+        if (x%get_count() /= n) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_CONCURRENT_DICTIONARY_1 (Test 1): " // &
+                "Expected ", n, " items in the dictionary, but found ", &
+                x%get_count(), "."
+            return
+        end if
+
+        ! Contend on the same keys via get_or_add, and check every item
+        !$omp parallel do private(key) reduction(+:nbad)
+        do i = 1, 2 * n
+            key = int(mod(i - 1, n) + 1, int64)
+            if (.not.check_concurrent_item(x, key, 2 * key, .true.)) &
+                nbad = nbad + 1
+        end do
+        !$omp end parallel do
+
+        if (nbad /= 0 .or. x%get_count() /= n) then
+            rst = .false.
+            print '(AI0A)', "TEST_CONCURRENT_DICTIONARY_1 (Test 2): " // &
+                "Found ", nbad, " incorrect items after get_or_add."
+            return
+        end if
+
+        ! Remove the odd keys while updating the even keys
+        !$omp parallel do private(key, temp)
+        do i = 1, n
+            key = int(i, int64)
+            if (mod(i, 2) == 1) then
+                temp = x%remove(key)
+            else
+                call x%set(key, 3 * key)
+            end if
+        end do
+        !$omp end parallel do
+
+        !$omp parallel do private(key) reduction(+:nbad)
+        do i = 1, n
+            key = int(i, int64)
+            if (mod(i, 2) == 1) then
+                if (x%contains_key(key)) nbad = nbad + 1
+            else if (.not.check_concurrent_item(x, key, 3 * key, .false.)) then
+                nbad = nbad + 1
+            end if
+        end do
+        !$omp end parallel do
+
+        if (nbad /= 0 .or. x%get_count() /= n / 2) then
+            rst = .false.
+            print '(AI0A)', "TEST_CONCURRENT_DICTIONARY_1 (Test 3): " // &
+                "Found ", nbad, " incorrect items after set/remove."
+            return
+        end if
+
+        ! Merge per-thread local dictionaries back into the shared dictionary.
+        ! Each thread contributes a distinct range of keys.
+        !$omp parallel private(key)
+        !$omp master
+        !$ nthreads = omp_get_num_threads()
+        !$omp end master
+        key = int(n + 1, int64)
+        !$ key = key + int(nlocal, int64) * omp_get_thread_num()
+        call merge_concurrent_items(x, key, nlocal)
+        !$omp end parallel
+
+        if (x%get_count() /= n / 2 + nlocal * nthreads) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_CONCURRENT_DICTIONARY_1 (Test 4): " // &
+                "Expected ", n / 2 + nlocal * nthreads, " items after " // &
+                "merging, but found ", x%get_count(), "."
+            return
+        end if
+
+        if (.not.check_concurrent_item(x, int(n + nlocal, int64), &
+                int(n + nlocal, int64), .false.)) then
+            rst = .false.
+            print '(A)', "TEST_CONCURRENT_DICTIONARY_1 (Test 5): " // &
+                "Incorrect item found after merging."
+            return
+        end if
+
+        ! Clear the dictionary
+        call x%clear()
+        if (x%get_count() /= 0 .or. x%contains_key(2_int64)) then
+            rst = .false.
+            print '(A)', "TEST_CONCURRENT_DICTIONARY_1 (Test 6): " // &
+                "Expected an empty dictionary after clearing."
+        end if
+    end function
+
 ! ------------------------------------------------------------------------------
 end module
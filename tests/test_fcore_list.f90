@@ -30,6 +30,29 @@ contains
         rst = i1 == i2
     end function
 
+! --------------------
+    function ints_near(item1, item2) result(rst)
+        class(*), intent(in) :: item1, item2
+        logical :: rst
+
+        integer(int32) :: i1, i2
+
+        i1 = 0
+        i2 = 2
+
+        select type (item1)
+        type is (integer(int32))
+            i1 = item1
+        end select
+
+        select type (item2)
+        type is (integer(int32))
+            i2 = item2
+        end select
+
+        rst = abs(i1 - i2) <= 1
+    end function
+
 ! --------------------
     function test_ints(item1, item2) result(rst)
         class(*), intent(in) :: item1, item2
@@ -422,5 +445,152 @@ contains
         end if
     end function
 
+! ------------------------------------------------------------------------------
+    function test_data_table_index() result(rst)
+        ! Arguments
+        logical :: rst
+
+        ! Parameters
+        integer(int32), parameter :: nrows = 1000
+        
+        ! Local Variables
+        type(data_table) :: tbl, tbl2
+        integer(int32) :: i, k, row, col
+        integer(int32), allocatable :: rows(:), expected(:)
+        procedure(items_equal), pointer :: eq, near
+        procedure(compare_items), pointer :: cmp
+
+        ! Initialization
+        rst = .true.
+        eq => compare_ints
+        cmp => test_ints
+        call tbl%initialize(nrows, 3)
+        do i = 1, nrows
+            call tbl%set(i, 1, 3 * i)
+            call tbl%set(i, 2, mod(7 * i, 50))
+            call tbl%set(i, 3, i)
+        end do
+        call tbl%set_header(1, "id")
+        call tbl%set_header(2, "group")
+        call tbl%set_header(3, "value")
+        call tbl%build_hash_index(1, eq)
+        call tbl%build_sorted_index(2, cmp)
+
+        ! Header lookups
+        if (tbl%get_column_index("group") /= 2) then
+            rst = .false.
+            print '(AI0A)', "TEST_DATA_TABLE_INDEX (Test 1); Expected: 2, " // &
+                "but found: ", tbl%get_column_index("group"), "."
+        end if
+        call tbl%set_header(3, "id")
+        call tbl%set_header(1, "key")
+        if (tbl%get_column_index("id") /= 3 .or. &
+            tbl%get_column_index("key") /= 1) &
+        then
+            rst = .false.
+            print '(A)', "TEST_DATA_TABLE_INDEX (Test 2); Renamed headers " // &
+                "were not found."
+        end if
+
+        ! Hash lookups
+        if (tbl%find(1, 300) /= 100 .or. tbl%find(1, 301) /= 0) then
+            rst = .false.
+            print '(AI0A)', "TEST_DATA_TABLE_INDEX (Test 3); Expected: " // &
+                "100, but found: ", tbl%find(1, 300), "."
+        end if
+
+        ! Range lookups - matching rows are ordered by value, then by row
+        rows = tbl%find_range(2, 10, 11)
+        expected = [(i, i = 1, nrows)]
+        expected = [pack(expected, mod(7 * expected, 50) == 10), &
+            pack(expected, mod(7 * expected, 50) == 11)]
+        if (size(rows) /= size(expected)) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_DATA_TABLE_INDEX (Test 4); Expected: ", &
+                size(expected), " rows, but found: ", size(rows), "."
+        else if (any(rows /= expected)) then
+            rst = .false.
+            print '(A)', "TEST_DATA_TABLE_INDEX (Test 4); Range lookup " // &
+                "returned the wrong rows."
+        end if
+
+        ! Indexes must follow updates
+        call tbl%set(5, 1, -1)
+        call tbl%set(5, 2, 100)
+        if (tbl%find(1, 15) /= 0 .or. tbl%find(1, -1) /= 5) then
+            rst = .false.
+            print '(A)', "TEST_DATA_TABLE_INDEX (Test 5); The hash index " // &
+                "was not updated by set."
+        end if
+        rows = tbl%find_range(2, 60, 200)
+        if (size(rows) /= 1) then
+            rst = .false.
+            print '(A)', "TEST_DATA_TABLE_INDEX (Test 6); The sorted " // &
+                "index was not updated by set."
+        else if (rows(1) /= 5) then
+            rst = .false.
+            print '(AI0A)', "TEST_DATA_TABLE_INDEX (Test 6); Expected: 5, " // &
+                "but found: ", rows(1), "."
+        end if
+
+        call tbl%insert_rows(1, reshape([-2, -3, 200, 200, 0, 0], [2, 3]))
+        call tbl%remove_rows(100, 10)
+        if (tbl%find(1, -1) /= 7 .or. tbl%find(1, 900) /= 292) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_DATA_TABLE_INDEX (Test 7); Expected: " // &
+                "7 and 292, but found: ", tbl%find(1, -1), " and ", &
+                tbl%find(1, 900), "."
+        end if
+        rows = tbl%find_range(2, 60, 200)
+        if (size(rows) /= 3) then
+            rst = .false.
+            print '(AI0A)', "TEST_DATA_TABLE_INDEX (Test 8); Expected: 3, " // &
+                "but found: ", size(rows), "."
+        else if (any(rows /= [7, 1, 2])) then
+            rst = .false.
+            print '(A)', "TEST_DATA_TABLE_INDEX (Test 8); The sorted " // &
+                "index was not updated by insert_rows/remove_rows."
+        end if
+
+        ! Searches using the indexed column
+        call tbl%index_of(-3, eq, row, col)
+        if (row /= 2 .or. col /= 1 .or. .not.tbl%contains(900, eq)) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_DATA_TABLE_INDEX (Test 9); Expected: " // &
+                "(2, 1), but found: (", row, ", ", col, ")."
+        end if
+
+        ! Column removal
+        call tbl%remove_columns(1, 1)
+        if (tbl%has_hash_index(1) .or. .not.tbl%has_sorted_index(1) .or. &
+            tbl%get_column_index("id") /= 2) &
+        then
+            rst = .false.
+            print '(A)', "TEST_DATA_TABLE_INDEX (Test 10); The indexes " // &
+                "were not shifted by remove_columns."
+        end if
+        k = size(tbl%find_range(1, 0, 49))
+        if (k /= tbl%get_row_count() - 3) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_DATA_TABLE_INDEX (Test 11); Expected: ", &
+                tbl%get_row_count() - 3, ", but found: ", k, "."
+        end if
+
+        ! contains and index_of must honor the comparison function, even if
+        ! it was also used to build a hash index
+        near => ints_near
+        call tbl2%initialize(10, 1)
+        do i = 1, 10
+            call tbl2%set(i, 1, 10 * i)
+        end do
+        call tbl2%build_hash_index(1, near)
+        call tbl2%index_of(41, near, row, col)
+        if (row /= 4 .or. col /= 1 .or. .not.tbl2%contains(99, near)) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_DATA_TABLE_INDEX (Test 12); Expected: " // &
+                "(4, 1), but found: (", row, ", ", col, ")."
+        end if
+    end function
+
 ! ------------------------------------------------------------------------------
 end module
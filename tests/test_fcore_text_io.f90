@@ -2,8 +2,12 @@
 
 module test_fcore_text_io
     use iso_fortran_env
+    !$ use omp_lib
+    use ferror
+    use fcore_constants
     use file_io
     use strings
+    use collections
     implicit none
 contains
     function test_text_read_write() result(rst)
@@ -45,4 +49,341 @@ contains
         end if
     end function
 
+! ------------------------------------------------------------------------------
+    function test_text_buffer() result(rst)
+        ! Arguments
+        logical :: rst
+
+        ! Parameters
+        character(len = *), parameter :: fname = "test_text_2.txt"
+        integer(int64), parameter :: nlines = 5001
+        ! 64-byte lines filling the first 1 MB index block exactly
+        integer(int64), parameter :: nshort = 16384
+        ! 100-byte lines filling out the rest of a file of over 2 MB
+        integer(int64), parameter :: nlong = 15000
+        ! The line containing the boundary between the second and third
+        ! index blocks
+        integer(int64), parameter :: straddle = nshort + 10486
+
+        ! Local Variables
+        type(text_writer) :: writer
+        type(text_reader) :: reader
+        type(text_buffer), target :: buffer
+        type(string), allocatable, dimension(:) :: lines
+        character(len = :), pointer :: view
+        character(len = :), allocatable :: line
+        character(len = 32) :: expected
+        integer(int64) :: i, k
+        integer(int64) :: checks(9)
+
+        ! Initialization
+        rst = .true.
+
+        ! Write the file.  Use both Windows and Unix style line endings, and
+        ! include empty lines in the middle and at the end of the file.
+        call writer%open(fname)
+        do i = 1, nlines
+            if (mod(i, 100_int64) == 0) then
+                call writer%write(new_line('a'))
+            else if (mod(i, 2_int64) == 0) then
+                write(expected, '(AI0)') "Line ", i
+                call writer%write(trim(expected) // char(13) // new_line('a'))
+            else
+                write(expected, '(AI0)') "Line ", i
+                call writer%write_line(trim(expected))
+            end if
+        end do
+        call writer%write(new_line('a') // new_line('a'))
+        call writer%close()
+
+        ! Index the file, and compare against read_lines
+        call buffer%load(fname)
+        call reader%open(fname)
+        lines = reader%read_lines()
+        call reader%close()
+
+        if (buffer%get_count() /= nlines) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_TEXT_BUFFER (Test #1): " // &
+                "Expected ", nlines, " lines, but found ", &
+                buffer%get_count(), "."
+            return
+        end if
+
+        do i = 1, nlines
+            line = buffer%get_line(i)
+            view => buffer%get_line_view(i)
+            if (line /= lines(i)%str .or. len(line) /= len(lines(i)%str)) then
+                rst = .false.
+                print '(AI0A)', "TEST_TEXT_BUFFER (Test #2): " // &
+                    "Line ", i, " does not match the expected value."
+                return
+            end if
+            if (view /= line .or. len(view) /= len(line) .or. &
+                buffer%get_line_length(i) /= len(line)) &
+            then
+                rst = .false.
+                print '(AI0A)', "TEST_TEXT_BUFFER (Test #3): " // &
+                    "The view of line ", i, " does not match the copy."
+                return
+            end if
+        end do
+
+        ! Index a string with no terminating new line character
+        call buffer%set_text("a" // new_line('a') // new_line('a') // "bc")
+        if (buffer%get_count() /= 3 .or. buffer%get_line(3_int64) /= "bc" &
+            .or. buffer%get_line_length(2_int64) /= 0) &
+        then
+            rst = .false.
+            print '(A)', "TEST_TEXT_BUFFER (Test #4): " // &
+                "The text was not indexed correctly."
+            return
+        end if
+
+        ! Index a file spanning several 1 MB index blocks.  The first 
+        ! nshort lines are 64 bytes each (including the new line character)
+        ! such that the new line ending line nshort falls exactly on the last
+        ! byte of the first block.  The remaining lines are 100 bytes each
+        ! such that the next block boundary falls within a line.
+        call writer%open(fname)
+        do i = 1, nshort + nlong
+            call writer%write_line(block_test_line(i, nshort))
+        end do
+        call writer%close()
+        call buffer%load(fname)
+
+        if (buffer%get_count() /= nshort + nlong) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_TEXT_BUFFER (Test #5): " // &
+                "Expected ", nshort + nlong, " lines, but found ", &
+                buffer%get_count(), "."
+            return
+        end if
+        checks = [1_int64, nshort - 1, nshort, nshort + 1, nshort + 2, &
+            straddle - 1, straddle, straddle + 1, nshort + nlong]
+        do k = 1, size(checks)
+            i = checks(k)
+            line = block_test_line(i, nshort)
+            if (buffer%get_line(i) /= line .or. &
+                buffer%get_line_length(i) /= len(line)) &
+            then
+                rst = .false.
+                print '(AI0A)', "TEST_TEXT_BUFFER (Test #6): " // &
+                    "Line ", i, " does not match the expected value."
+                return
+            end if
+        end do
+    end function
+
+! --------------------
+    function block_test_line(i, nshort) result(rst)
+        integer(int64), intent(in) :: i, nshort
+        character(len = :), allocatable :: rst
+        character(len = 32) :: label
+        write(label, '(AI0)') "Line ", i
+        if (i <= nshort) then
+            rst = repeat("-", 63)
+        else
+            rst = repeat("-", 99)
+        end if
+        rst(1:len_trim(label)) = trim(label)
+    end function
+
+! ------------------------------------------------------------------------------
+    function test_text_write_delimited() result(rst)
+        ! Arguments
+        logical :: rst
+
+        ! Parameters
+        character(len = *), parameter :: fname = "test_text_3.txt"
+        integer(int32), parameter :: m = 2000
+        integer(int32), parameter :: n = 7
+
+        ! Local Variables
+        type(text_writer) :: writer
+        type(text_buffer) :: buffer
+        type(data_table) :: tbl
+        type(string), allocatable, dimension(:) :: items
+        type(errors) :: err
+        real(real64) :: x(m, n)
+        integer(int64) :: ix(m, n)
+        integer(int32) :: i, j
+
+        ! Initialization
+        rst = .true.
+        call random_number(x)
+        x = 1.0d3 * (x - 0.5d0)
+        x(1,1) = 0.1d0
+        x(2,1) = -1.0d-300
+        x(3,1) = huge(1.0d0)
+        ix = int(1.0d9 * x(:,:), int64)
+        ix(1,1) = -huge(1_int64)
+
+        ! Write and read back the floating-point matrix.  Each value must 
+        ! read back exactly.
+        call writer%open(fname)
+        call writer%write_delimited(x, delim = ";")
+        call writer%close()
+        call buffer%load(fname)
+        if (buffer%get_count() /= m) then
+            rst = .false.
+            print '(AI0AI0A)', "TEST_TEXT_WRITE_DELIMITED (Test #1): " // &
+                "Expected ", m, " lines, but found ", buffer%get_count(), "."
+            return
+        end if
+        do i = 1, m
+            items = split_string(buffer%get_line(int(i, int64)), ";")
+            do j = 1, n
+                if (parse_real64(items(j)) /= x(i,j)) then
+                    rst = .false.
+                    print '(AI0AI0A)', &
+                        "TEST_TEXT_WRITE_DELIMITED (Test #2): " // &
+                        "Value (", i, ", ", j, ") did not read back exactly."
+                    return
+                end if
+            end do
+        end do
+
+        ! Write and read back the integer matrix
+        call writer%open(fname)
+        call writer%write_delimited(ix)
+        call writer%close()
+        call buffer%load(fname)
+        do i = 1, m
+            items = split_string(buffer%get_line(int(i, int64)), ",")
+            do j = 1, n
+                if (parse_int64(items(j)) /= ix(i,j)) then
+                    rst = .false.
+                    print '(AI0AI0A)', &
+                        "TEST_TEXT_WRITE_DELIMITED (Test #3): " // &
+                        "Value (", i, ", ", j, ") did not read back exactly."
+                    return
+                end if
+            end do
+        end do
+
+        ! Write a data_table containing mixed types
+        call tbl%initialize(2, 3)
+        call tbl%set_header(1, "Name")
+        call tbl%set_header(2, "Value")
+        call tbl%set_header(3, "Count")
+        call tbl%set(1, 1, "first, item")
+        call tbl%set(1, 2, 1.5d0)
+        call tbl%set(1, 3, 3)
+        call tbl%set(2, 1, "second")
+        call tbl%set(2, 2, 0.25d0)
+        call tbl%set(2, 3, 4_int64)
+        call writer%open(fname)
+        call writer%write_delimited(tbl)
+        call writer%close()
+        call buffer%load(fname)
+        if (buffer%get_count() /= 3 .or. &
+            buffer%get_line(1_int64) /= "Name,Value,Count" .or. &
+            buffer%get_line(2_int64) /= '"first, item",1.5,3' .or. &
+            buffer%get_line(3_int64) /= "second,0.25,4") &
+        then
+            rst = .false.
+            print '(A)', "TEST_TEXT_WRITE_DELIMITED (Test #4): " // &
+                "The data_table was not written as expected."
+            return
+        end if
+
+        ! A format string unsuitable for the data must be reported, not abort
+        call err%set_exit_on_error(.false.)
+        call writer%open(fname)
+        call writer%write_delimited(x, fmt = "(I5)", err = err)
+        call writer%close()
+        if (err%get_error_flag() /= FCORE_FILE_IO_ERROR) then
+            rst = .false.
+            print '(AI0A)', "TEST_TEXT_WRITE_DELIMITED (Test #5): " // &
+                "Expected FCORE_FILE_IO_ERROR, but found ", &
+                err%get_error_flag(), "."
+            return
+        end if
+
+        ! As must a format producing values wider than the formatting buffer
+        call err%reset_error_status()
+        call writer%open(fname)
+        call writer%write_delimited(x, fmt = "(ES200.3)", err = err)
+        call writer%close()
+        if (err%get_error_flag() /= FCORE_FILE_IO_ERROR) then
+            rst = .false.
+            print '(AI0A)', "TEST_TEXT_WRITE_DELIMITED (Test #6): " // &
+                "Expected FCORE_FILE_IO_ERROR, but found ", &
+                err%get_error_flag(), "."
+            return
+        end if
+    end function
+
+
+! ------------------------------------------------------------------------------
+    function test_text_write_delimited_blocks() result(rst)
+        ! Arguments
+        logical :: rst
+
+        ! Parameters
+        character(len = *), parameter :: fname = "test_text_4.txt"
+        integer(int32), parameter :: m = 300000
+        integer(int32), parameter :: n = 3
+
+        ! Local Variables
+        type(text_writer) :: writer
+        type(text_buffer) :: buffer
+        integer(int64), allocatable, dimension(:,:) :: x
+        integer(int32) :: i, j, nthreads, rows, nblocks, nbatch
+        character(len = 64) :: expected
+
+        ! Initialization
+        rst = .true.
+        allocate(x(m, n))
+        do j = 1, n
+            do i = 1, m
+                x(i,j) = 10_int64 * i + j
+            end do
+        end do
+
+        ! Use two threads, and ensure the matrix spans several batches of
+        ! blocks
+        nthreads = 1
+        !$ nthreads = omp_get_max_threads()
+        !$ call omp_set_num_threads(2)
+        call delimited_block_plan(m, n, rows, nblocks, nbatch)
+        if (nblocks <= nbatch) then
+            rst = .false.
+            print '(AI0AI0A)', &
+                "TEST_TEXT_WRITE_DELIMITED_BLOCKS (Test #1): " // &
+                "Expected the ", nblocks, " blocks to span more than one " // &
+                "batch of ", nbatch, " blocks."
+        end if
+
+        ! Write the file
+        call writer%open(fname)
+        call writer%write_delimited(x)
+        call writer%close()
+        !$ call omp_set_num_threads(nthreads)
+        if (.not.rst) return
+
+        ! Read the file back, and check every row
+        call buffer%load(fname)
+        if (buffer%get_count() /= m) then
+            rst = .false.
+            print '(AI0AI0A)', &
+                "TEST_TEXT_WRITE_DELIMITED_BLOCKS (Test #2): " // &
+                "Expected ", m, " lines, but found ", buffer%get_count(), "."
+            return
+        end if
+        do i = 1, m
+            write(expected, '(I0,",",I0,",",I0)') x(i,:)
+            if (buffer%get_line(int(i, int64)) /= trim(expected)) then
+                rst = .false.
+                print '(AI0AI0AI0A)', &
+                    "TEST_TEXT_WRITE_DELIMITED_BLOCKS (Test #3): " // &
+                    "Row ", i, " (block ", (i - 1) / rows + 1, " of ", &
+                    nblocks, ") does not match: " // &
+                    buffer%get_line(int(i, int64)) // " vs. " // trim(expected)
+                return
+            end if
+        end do
+    end function
+
 end module